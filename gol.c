@@ -11,11 +11,121 @@
  MPI Implementation von "Game Of Life" => Conway's Spiel des Lebens
  - dynamische Spielrundenanzahl (Anzahl wird beim Programmstart abgefragt)
  - dynamisches Spielfeld (Dimension wird beim Programmstart abgefragt)
- - Spielfeld wird in Teilspielfelder aufgeteilt (ein Teil pro Prozess)
+ - Spielfeld wird in Teilspielfelder aufgeteilt (ein Block pro Prozess, kartesisches Prozessgitter)
+ - Spielfeld wird bitweise gespeichert (64 Zellen pro Wort), eine Spielrunde
+   berechnet mit einem Bit-Addierwerk 64 Zellen auf einmal
  - Grenzen (= Überlappung der Teilspielfelder) werden zwischen den Prozessen ausgetauscht
  - Berechnung und Ausgabe der Rechenzeit beim Programmende
+ - Demomodus mit eigenem Renderthread (schreibt direkt in die Pixel des Fensters), große Spielfelder
+   werden verkleinert dargestellt
+ - Sicherungen des Spielfelds in regelmäßigen Abständen bzw. auf ein Signal: alle Procs schreiben ihre Blöcke
+   kollektiv per MPI-IO in eine gemeinsame Datei (im Hintergrund weiterrechnend); Fortsetzen auch mit einer
+   anderen Prozessanzahl
+ - Anfangsbedingungen zufällig oder aus einer Musterdatei (RLE bzw. .cells); die Datei wird per MPI-IO
+   gelesen, jeder Proc dekodiert nur seine eigenen Zeilen
+ - Zufallswerte aus einem zählerbasierten Generator (Philox) über der Lage im Spielfeld: gleiche Saat ergibt
+   dasselbe Spielfeld für jede Prozessanzahl, jeder Proc füllt seine Worte mit allen Threads
+ - alle Spielparameter auch über Kommandozeile bzw. Konfigurationsdatei (Stapelbetrieb),
+   Benchmark für starke und schwache Skalierung mit Ergebnissen als CSV
+ - das Vollspielfeld wird nur bei Bedarf bei ROOT zusammengetragen (Demomodus,
+   Schnappschuss, Ergebnis der letzten Runde)
+ - nur Kacheln (32 Zeilen x 512 Zellen), in deren Nachbarschaft sich in der letzten Runde etwas
+   geändert hat, werden neu berechnet; unveränderte Überlappungen werden nicht gesendet
+ - innerhalb eines Prozesses rechnen mehrere Threads (OpenMP) die Kacheln, so reichen wenige
+   Prozesse pro Knoten (weniger Nachrichten und Überlappungen)
+ - alternativ Hashlife (Quadtree mit gemerkten Teilergebnissen) für lange Läufe mit
+   dünn besetzten, periodischen Mustern, springt um 2^n Runden
+ - auf Wunsch dynamische Lastverteilung: Zeilen wandern von langsamen zu schnellen Prozesszeilen
+   (ungleiche Knoten, Aktivität in einem Teil des Spielfelds)
+ - auf Wunsch Zeitmessung pro Phase einer Runde (Austausch, Rechnen, Warten, Sammeln, Ausgabe) mit
+   Taktzähler und Hardwarezählern, Auswertung über alle Procs und Spurdateien für chrome://tracing
+ - beliebige Regeln in B/S-Schreibweise (für bekannte Regeln eigene Kernel mit festen Masken) und
+   wahlweise Torus statt totem Rand
+ - auf Wunsch Erkennung von Stillleben und Oszillatoren über Fingerabdrücke des Spielfelds, vorzeitiges Ende
+ - Procs auf demselben Knoten lesen die Überlappungen direkt aus den Spielfeldern ihrer Nachbarn (gemeinsames
+   MPI-Fenster), zwischen Knoten dauerhafte Requests
+ - Ensemble-Modus für Parameterstudien: viele kleine Bretter bis zur Stabilisierung, dynamisch über alle Procs
+   und Threads verteilt, je Brett eine Ergebniszeile
+ - Spielfelder größer als der Hauptspeicher: beide Generationen in Dateien (im Format der Sicherung), in den Speicher
+   abgebildet und bandweise durch ein kleines Fenster gerechnet, mit Vorauslesen und Zurückschreiben im Hintergrund
 
- starten mit (N = Anzahl der Prozesse): mpirun -np N mpi_gol
+ übersetzen mit: mpicc -O2 -fopenmp mpi_gol.c -lSDL -o mpi_gol
+ starten mit (N = Anzahl der Prozesse): mpirun -np N mpi_gol [Optionen]
+ Optionen:
+   -schnappschuss N   alle N Runden das Vollspielfeld als gol_<Runde>.pbm speichern
+   -halo K            K Randzeilen auf einmal austauschen und K Runden lokal rechnen (1 ... 64)
+   -engine E          Rechenverfahren: stencil (Standard, seriell bzw. parallel), hashlife (Quadtree mit
+                      gemerkten Teilergebnissen, rechnet nur bei ROOT) oder datei (Spielfeld in Dateien statt im
+                      Hauptspeicher, rechnet nur bei ROOT; POSIX)
+   -hl_speicher MB    Speichergrenze der Hashlife-Knoten in MB, darüber wird aufgeräumt (Standard 1024)
+   -datei_praefix P   -engine datei: die Generationen liegen abwechselnd in P_0.bin und P_1.bin (Standard gol_datei);
+                      nach jeder Runde ist die neuere Datei eine gültige Sicherung (für -fortsetzen), -sicherung
+                      entfällt, SIGTERM beendet nach der laufenden Runde
+   -datei_fenster MB  -engine datei: Speicher für das Fenster, bestimmt die Zeilen pro Band (Standard 64)
+   -kacheln 0|1       nur Kacheln mit Änderungen in der Nachbarschaft rechnen und unveränderte
+                      Überlappungen nicht senden (Standard 1)
+   -threads T         T Threads pro Prozess (mit OpenMP übersetzt); Standard: Kerne des Knotens geteilt
+                      durch die Prozesse auf dem Knoten, z.B. mpirun -np 8 --map-by ppr:2:node mpi_gol
+   -muster DATEI      Anfangsbedingungen aus DATEI (RLE oder Klartext .cells) statt Zufallswerten
+   -saat S, -dichte D Saat und Anteil lebender Zellen (0 ... 1 bzw. Prozent, Standard 0.5) der Zufallswerte; ohne
+                      -saat wählt ROOT sie aus der Uhrzeit und gibt sie aus. Gleiche Saat = gleiches Spielfeld,
+                      unabhängig von der Prozessanzahl
+   -versatz X,Y       linke obere Musterzelle bei Spalte X, Zeile Y (ab 0; Standard: Muster mittig)
+   -sicherung N       alle N Runden das Spielfeld sichern; "signal" = nur auf ein Signal (Standard: aus)
+                      SIGUSR1 = sichern und weiterrechnen, SIGTERM = sichern und beenden
+   -sicherung_datei DATEI
+                      Name der Sicherungsdatei (Standard gol_sicherung.bin)
+   -fortsetzen DATEI  Spiel aus einer Sicherung fortsetzen (Dimension und Runde aus der Datei, -runden
+                      zählt ab dem Anfang des ursprünglichen Spiels)
+   -dim N, -runden N  Spielfelddimension und Rundenanzahl; sind beide angegeben, läuft das Programm
+                      ohne Abfragen (Stapelbetrieb, Demomodus nur mit -demo 1)
+   -hoehe N, -zelle N, -speed MS
+                      Bildschirmhöhe, Zellgröße und Mindestabstand der angezeigten Bilder im Demomodus
+                      (800, 5, 500); die Simulation wartet nicht auf die Anzeige
+   -demo 0|1          Demomodus aus bzw. an (Standard: an, wenn das Spielfeld auf den Bildschirm passt);
+                      größere Spielfelder werden verkleinert, ein Pixel zeigt den Anteil lebender Zellen
+   -konfig DATEI      Optionen aus DATEI lesen, eine pro Zeile ohne Minus ("dim 2000"), # = Kommentar
+   -benchmark ART     Skalierungsmessung statt eines Spiels: stark, schwach oder beide
+                      starke Skalierung: gleiche Spielfelder auf 1, 2, 4, ... N Prozessen
+                      schwache Skalierung: Fläche pro Prozess konstant (Dimension * Wurzel der Prozesse)
+                      kernel: jeder Kernel allein (ein Thread) auf Spielfeldern in L1, L2, L3 und im
+                      Hauptspeicher, Zellen pro ns; vorher Vergleich mit dem skalaren Kernel
+   -ensemble N        statt eines Spiels N unabhängige Bretter -dim x -dim (Zufallswerte, toter Rand), jedes bis
+                      zu einem Zyklus (Perioden bis -zyklus, Standard 30) oder höchstens -runden Runden; Brett b hat
+                      die Saat -saat + b. Bretter werden dynamisch an Procs und Threads verteilt, mehrere
+                      nebeneinander in einem Streifen gerechnet
+   -ensemble_breite K Bretter nebeneinander pro Streifen (Standard: Streifen von etwa 32 Worten)
+   -ensemble_datei DATEI
+                      je Brett eine CSV-Zeile (Brett, Saat, erste Runde des Zyklus, Periode, Runden, lebende
+                      Zellen) in DATEI statt auf die Standardausgabe
+   -pruefen 0|1       statt eines Spiels für jede Dimension und Rundenanzahl aus -bench_dims und -bench_runden
+                      die parallele Version auf 1 ... N Prozessen gegen die serielle prüfen (Endspielfeld Bit
+                      für Bit, gleiche Saat); mit -engine hashlife bzw. datei auch diese. Rückgabewert 1 bei Abweichung
+   -bench_dims L, -bench_runden L
+                      kommagetrennte Listen der Dimensionen und Rundenanzahlen (1000,2000,4000 bzw. 100)
+   -bench_wdh N, -bench_aufwaermen N
+                      gemessene Wiederholungen und ungemessene Aufwärmläufe je Messpunkt (5 bzw. 1)
+   -bench_datei DATEI Ergebnisse als CSV in DATEI statt auf die Standardausgabe
+   -profil 0|1|2      Zeiten pro Phase messen und am Ende Minimum, Mittel, Maximum und Ungleichgewicht
+                      über alle Procs ausgeben; 2 = zusätzlich Hardwarezähler (Linux perf_event, Takte,
+                      Befehle, Cache-Fehlzugriffe des Hauptthreads; ein Systemaufruf pro Phasenwechsel)
+   -spur PRÄFIX       Phasen jeder Runde als Chrome-Trace (JSON) in PRÄFIX_<Proc>.json schreiben
+                      (schaltet -profil 1 ein; Zeitachse ab dem gemeinsamen Start aller Procs)
+   -umverteilen N     alle N Runden die Rechenzeiten der Prozesszeilen vergleichen und Zeilen zwischen
+                      benachbarten Prozesszeilen verschieben (Standard: aus)
+   -umverteilen_schwelle P
+                      erst umverteilen, wenn die langsamste Prozesszeile P % über dem Mittel liegt (Standard 10)
+   -regel R           Regel in B/S-Schreibweise, z.B. B36/S23 (HighLife) oder B2/S (Seeds); auch die alte
+                      Schreibweise Überleben/Geburt (23/36); Standard B3/S23
+   -rand tot|torus    außerhalb des Spielfelds ist alles tot (Standard) bzw. gegenüberliegende Ränder sind
+                      Nachbarn (Torus; nicht mit -engine hashlife)
+   -zyklus P          Zyklen bis zur Periode P erkennen (Stillleben: P = 1) und melden; jeder Proc führt beim Rechnen
+                      einen Fingerabdruck seines Bereichs nach, alle max(P, 32) Runden ein MPI_Allreduce
+                      (Standard: aus; nur -engine stencil)
+   -zyklus_ende 0|1   nach einem erkannten Zyklus beenden (Standard 0)
+   -fenster 0|1       Procs auf demselben Knoten legen ihre Spielfelder in ein gemeinsames Fenster und kopieren
+                      die Überlappungen direkt vom Nachbarn, nur zwischen Knoten gehen Nachrichten (Standard 1;
+                      nicht mit -umverteilen, dort ändern die Spielfelder ihre Größe)
 
  ============================================================================
  */
@@ -28,12 +138,23 @@
 #include <stdio.h>
 #include <stdlib.h>
 
+// Bibliothek für uint64_t
+#include <stdint.h>
+
 // Bibliothek für time()
 #include <time.h>
 
 // Bibliothek für u. A. memcpy()
 #include <string.h>
 
+// Bibliothek für signal(): Sicherung auf SIGTERM bzw. SIGUSR1
+#include <signal.h>
+
+// OpenMP für Threads innerhalb eines Procs (übersetzen mit -fopenmp, sonst ein Thread pro Proc)
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 // Bibliotheken für sleep() und usleep(); je nach Betriebssystem
 #if WIN32
 #include <sleep.h> // WINDOWS
@@ -41,41 +162,585 @@
 #include <unistd.h> // POSIX
 #endif
 
+// Spielfeld in abgebildeten Dateien (-engine datei): mmap, madvise und posix_fadvise nur unter POSIX
+#if WIN32
+#define GOL_MMAP 0
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#define GOL_MMAP 1
+#endif
+
+// Hardwarezähler über perf_event nur unter Linux
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#define GOL_PERF 1
+#else
+#define GOL_PERF 0
+#endif
+
 // globale Difinitionen
 #define ROOT 0 // Rootprozess-ID; ROOT hat das Vollspielfeld
+#define WORT_BITS 64 // Zellen pro Speicherwort (uint64_t)
+
+// SIMD-Kernel nur mit GCC/Clang auf x86 (Vektorerweiterung und __builtin_cpu_supports)
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define GOL_SIMD 1
+#else
+#define GOL_SIMD 0
+#endif
+
+// Taktzähler für die Zeitmessung pro Phase: Zeitstempelzähler auf x86 (konstante Rate), sonst MPI_Wtime in ns
+#if GOL_SIMD
+#define GOL_TAKT() ((uint64_t) __builtin_ia32_rdtsc())
+#else
+#define GOL_TAKT() ((uint64_t) (MPI_Wtime() * 1e9))
+#endif
+
+/**
+ * Richtungen der Nachbarn im Prozessgitter (Index in nachbar[])
+ * gegenüberliegende Richtungen stehen paarweise nebeneinander: Gegenrichtung von d ist d ^ 1
+ */
+enum { OBEN, UNTEN, LINKS, RECHTS, OBEN_LINKS, UNTEN_RECHTS, OBEN_RECHTS, UNTEN_LINKS };
+
+/**
+ * Zugriff auf Zelle j (1 ... dim) einer bitweise gespeicherten Zeile
+ * Wort 0 ist der linke Rand, Zelle j liegt in Wort 1 + (j - 1) / 64 an Bit (j - 1) % 64
+ */
+#define ZELLE(zeile, j) (((zeile)[1 + ((j) - 1) / WORT_BITS] >> (((j) - 1) % WORT_BITS)) & 1)
+#define ZELLE_SETZEN(zeile, j) ((zeile)[1 + ((j) - 1) / WORT_BITS] |= (uint64_t) 1 << (((j) - 1) % WORT_BITS))
+
+// Anzahl der gesetzten Bits (lebenden Zellen) eines Wortes
+#if defined(__GNUC__)
+#define GOL_POPCOUNT(w) __builtin_popcountll(w)
+#else
+#define GOL_POPCOUNT(w) GOL_popcount_portabel(w)
+#endif
+
+/**
+ * Überlappung mit einem Nachbarn: MPI-Datentyp sowie Zeile und Wort, ab denen
+ * der eigene Rand gesendet bzw. die Überlappung des Nachbarn empfangen wird
+ */
+typedef struct {
+	MPI_Datatype typ;
+	int sende_zeile, sende_wort;
+	int hole_zeile, hole_wort;
+} GOL_ueberlappung;
+
+/**
+ * Austausch der Überlappungen eines Teilspielfelds (GOL_parallel)
+ * Beide Spielfelder liegen, wenn möglich, in einem gemeinsamen Fenster aller Procs des Knotens (MPI_Win_allocate_shared):
+ * die Überlappung eines Nachbarn auf demselben Knoten wird direkt aus seinem Spielfeld kopiert, Nachrichten ohne
+ * Inhalt melden nur "Generation fertig" (bereit) und "Rand gelesen" (quittung). Für alle übrigen Nachbarn gibt es
+ * dauerhafte Requests (MPI_Send_init / MPI_Recv_init), je Spielfeld ein Satz, gesendet wird volle oder leere Überlappung.
+ */
+typedef struct {
+	MPI_Comm knoten; // Procs mit gemeinsamem Speicher (MPI_COMM_NULL: kein Fenster)
+	MPI_Win fenster; // beide Spielfelder aller Procs des Knotens (MPI_WIN_NULL: eigener Speicher)
+	uint64_t **feld[2]; // die beiden Spielfelder, feld[0] hält die Anfangsgeneration
+	int nachbar[8]; // Nachbarn im Prozessgitter
+	int gemeinsam[8]; // Nachbar in Richtung d liegt im Fenster
+	uint64_t *quelle[2][8]; // gemeinsam: erstes Wort des Randes, den der Nachbar in Richtung d in seinem Spielfeld bereithält
+	int quelle_worte[8]; // gemeinsam: Worte pro Zeile beim Nachbarn
+	int form[8][2]; // Zeilen und Worte der Überlappung je Richtung
+	MPI_Request hole[2][8], sende[2][8][2]; // dauerhafte Requests je Spielfeld und Richtung (sende: leer bzw. voll)
+	MPI_Request bereit[16], quittung[16]; // gemeinsam: Nachrichten ohne Inhalt je Richtung (empfangen, senden)
+	MPI_Request laufend[16], laufend_quittung[16]; // gestartete Requests des laufenden Austauschs
+	int n_laufend, n_quittung; // ... und ihre Anzahl
+	int index[8]; // Stelle des Empfangs-Requests je Richtung in laufend
+} GOL_austausch;
+
+/**
+ * Kacheln über dem eigenen Teil eines Spielfelds (Zeilen z0 ... z0 + zeilen - 1, Worte 1 ... worte)
+ * "geändert" heißt: anders als vor zwei Runden. Im Zielspielfeld steht immer die vorletzte Generation
+ * (Doppelpuffer); ist die Nachbarschaft einer Kachel gleich der von vor zwei Runden, ist die nächste
+ * Generation gleich der vorletzten und die Kachel muss weder berechnet noch kopiert werden.
+ * So bleiben auch Blinker und andere Oszillatoren der Periode 2 ruhig.
+ */
+#define KACHEL_ZEILEN 32 // Zeilen pro Kachel
+#define KACHEL_WORTE 8 // Worte pro Kachel (512 Zellen), eine Kachel belegt 2 KB pro Spielfeld
+typedef struct {
+	int z0, zeilen, worte; // eigener Bereich im Spielfeld
+	int kz, kw; // Anzahl der Kacheln in Zeilen- und Wortrichtung
+	unsigned char *geaendert; // kz x kw: Kachel hat sich in der laufenden bzw. letzten Runde geändert
+	unsigned char *rechnen; // kz x kw: Kachel wird in dieser Runde berechnet
+	int erste; // erste Runde: vor der Anfangsgeneration gibt es keine vorletzte, alles gilt als geändert
+	long long gerechnet, gesamt; // berechnete und insgesamt geplante Kacheln (Statistik)
+	int zeile0, wort0; // Lage des eigenen Bereichs im Spielfeld (erste eigene Zeile und erstes eigenes Wort, ab 0)
+	uint64_t hash, hash_vorher; // Fingerabdruck des eigenen Bereichs der neuesten und der vorherigen Generation
+} GOL_kacheln;
+
+/**
+ * Zykluserkennung (optionen.zyklus): jeder Proc merkt sich den Fingerabdruck seines Bereichs je Generation,
+ * alle block Generationen werden sie per MPI_Allreduce zum Fingerabdruck des ganzen Spielfelds addiert und
+ * mit den letzten optionen.zyklus Generationen verglichen
+ */
+#define GOL_ZYKLUS_BLOCK 32 // Generationen pro MPI_Allreduce (mindestens)
+typedef struct {
+	int block; // Generationen pro MPI_Allreduce
+	uint64_t *lokal; // eigene Fingerabdrücke seit dem letzten MPI_Allreduce
+	uint64_t *verlauf; // Fingerabdrücke des Spielfelds: bis zu optionen.zyklus alte, dahinter die neuen
+	int n_lokal, n_verlauf; // Anzahl der Einträge
+	int runde; // Runde des ersten Eintrags in verlauf
+	int periode; // Periode des gefundenen Zyklus (0 = noch keiner)
+} GOL_zyklus;
+
+/**
+ * Spielparameter aus der Kommandozeile bzw. vom ROOT-Prozess
+ * ROOT füllt die Struktur, alle anderen Procs bekommen sie per MPI_Bcast
+ */
+typedef struct {
+	int demo; // Demomodus aktiv (nur ROOT hat das Fenster); -1 = automatisch, wenn das Spielfeld auf den Bildschirm passt
+	int schnappschuss; // alle n Runden das Vollspielfeld als PBM-Datei speichern (0 = aus)
+	int halo; // Tiefe der Überlappung in Zeilen = Runden pro Austausch der Überlappungen
+	int engine; // Rechenverfahren: GOL_STENCIL, GOL_HASHLIFE oder GOL_DATEI
+	int hl_speicher; // Speichergrenze der Hashlife-Knoten in MB
+	int kacheln; // nur Kacheln mit Änderungen rechnen, unveränderte Überlappungen nicht senden
+	int threads; // Threads pro Proc (0 = Kerne des Knotens / Procs pro Knoten)
+	int hoehe, zelle, dim, runden, speed; // Spielparameter (0 = beim Start abfragen bzw. Standardwert)
+	int ausgabe; // Ergebnis der letzten Runde und Statistik ausgeben (im Benchmark aus)
+	int benchmark; // Benchmark: 0 = aus, sonst GOL_STARK und/oder GOL_SCHWACH
+	int bench_wdh; // gemessene Wiederholungen je Messpunkt
+	int bench_aufwaermen; // ungemessene Aufwärmläufe je Messpunkt
+	int bench_dims[16], bench_n_dims; // Spielfelddimensionen der Messreihe (schwache Skalierung: pro Proc)
+	int bench_runden[16], bench_n_runden; // Rundenanzahlen der Messreihe
+	char bench_datei[256]; // Ergebnisse als CSV in diese Datei (leer = Standardausgabe)
+	int profil; // Zeitmessung pro Phase: 0 = aus, 1 = Zeiten, 2 = Zeiten und Hardwarezähler
+	char spur[256]; // Präfix der Spurdateien (leer = keine Spur)
+	char muster[256]; // Musterdatei für die Anfangsbedingungen (leer = Zufallswerte)
+	int versatz[2], versatz_gesetzt; // Spalte und Zeile der linken oberen Musterzelle (sonst mittig)
+	int sicherung; // alle n Runden sichern (0 = aus, -1 = nur auf ein Signal)
+	char sicherung_datei[256]; // Name der Sicherungsdatei
+	char fortsetzen[256]; // Sicherung, aus der fortgesetzt wird (leer = neues Spiel)
+	int start_runde; // Runde, mit der das Spiel beginnt (aus der Sicherung)
+	int umverteilen; // alle n Runden die Zeilen nach den Rechenzeiten umverteilen (0 = aus)
+	int umverteilen_schwelle; // Ungleichgewicht in Prozent, ab dem umverteilt wird
+	char regel[32]; // Regel in B/S-Schreibweise (leer = B3/S23)
+	int torus; // Rand: 0 = ausserhalb des Spielfelds kein Leben, 1 = Torus (gegenüberliegende Ränder sind Nachbarn)
+	int zyklus; // Zyklen bis zu dieser Periode erkennen (0 = aus)
+	int zyklus_ende; // nach einem erkannten Zyklus beenden
+	unsigned long long saat; // Saat der Zufallswerte
+	int saat_gesetzt; // Saat angegeben (sonst wählt ROOT sie aus der Uhrzeit)
+	double dichte; // Anteil lebender Zellen der Zufallswerte
+	int fenster; // Nachbarn auf demselben Knoten lesen die Ränder direkt aus einem gemeinsamen Fenster
+	int pruefen; // statt eines Spiels die parallele gegen die serielle Version prüfen
+	long long ensemble; // statt eines Spiels so viele unabhängige Bretter rechnen (0 = aus)
+	int ensemble_breite; // Bretter nebeneinander in einem Streifen (0 = automatisch)
+	char ensemble_datei[256]; // Ergebnisse je Brett als CSV in diese Datei (leer = Standardausgabe)
+	char datei_praefix[256]; // -engine datei: Präfix der beiden Spielfelddateien
+	int datei_fenster; // -engine datei: Speicher für das Fenster in MB
+} GOL_optionen;
+enum { GOL_STENCIL, GOL_HASHLIFE, GOL_DATEI };
+enum { GOL_STARK = 1, GOL_SCHWACH = 2, GOL_KERNEL = 4 }; // Messarten im Benchmark
+// Standardwerte (nicht genannte Felder sind 0 bzw. leer)
+GOL_optionen optionen = {
+	.demo = -1,
+	.halo = 1,
+	.engine = GOL_STENCIL,
+	.hl_speicher = 1024,
+	.kacheln = 1,
+	.ausgabe = 1,
+	.bench_wdh = 5,
+	.bench_aufwaermen = 1,
+	.sicherung_datei = "gol_sicherung.bin",
+	.umverteilen_schwelle = 10,
+	.dichte = 0.5,
+	.fenster = 1,
+	.datei_praefix = "gol_datei",
+	.datei_fenster = 64
+};
+
+/**
+ * Sicherung, die gerade im Hintergrund geschrieben wird (datei = MPI_FILE_NULL: keine)
+ */
+typedef struct {
+	MPI_File datei; // temporäre Sicherungsdatei
+	MPI_Request request; // für MPI_File_iwrite_all
+	MPI_Datatype ansicht; // eigener Block im Gesamtspielfeld
+	uint64_t *puffer; // Kopie des eigenen Blocks (das Spielfeld rechnet weiter)
+	MPI_Comm comm; // Kommunikator der schreibenden Procs
+	int runde; // gesicherte Runde
+} GOL_sicherung;
+#define GOL_SICHERUNG_LEER { .datei = MPI_FILE_NULL, .request = MPI_REQUEST_NULL, .ansicht = MPI_DATATYPE_NULL, .puffer = NULL, \
+		.comm = MPI_COMM_NULL, .runde = 0 } // keine Sicherung im Hintergrund
+
+// vom Signal-Handler gesetzt: Anzahl der Signale (je eine Sicherung) und ob danach beendet wird
+volatile sig_atomic_t GOL_signal = 0, GOL_signal_ende = 0;
+
+/**
+ * Hashlife-Knoten (Quadtree)
+ * Ebene 3 sind Blätter mit 8 x 8 Zellen in einem Wort (Zelle in Zeile r, Spalte c an Bit 8 * r + c),
+ * ab Ebene 4 hat ein Knoten vier Quadranten der Ebene darunter. Jeder Teilbaum existiert nur einmal
+ * (kanonisch über die Hashtabelle), gleiche Teilbäume sind also derselbe Zeiger.
+ */
+typedef struct GOL_knoten {
+	struct GOL_knoten *nw, *no, *sw, *so; // Quadranten nordwest, nordost, südwest, südost (NULL bei Blättern)
+	struct GOL_knoten *kette; // nächster Knoten in derselben Zeile der Hashtabelle
+	struct GOL_knoten *ergebnis; // gemerkte Mitte nach 2^(ebene - 2) Runden (NULL = noch nicht berechnet)
+	struct GOL_knoten *ergebnis_klein; // gemerkte Mitte nach 2^schritt_klein Runden (kleinere Sprünge)
+	uint64_t bits; // Zellen eines Blatts
+	long long lebende; // Anzahl der lebenden Zellen im Teilbaum
+	int ebene; // Kantenlänge 2^ebene Zellen
+	int schritt_klein; // Sprungweite (log2) von ergebnis_klein
+	int markiert; // für die Speicherbereinigung
+} GOL_knoten;
+
+/**
+ * Phasen einer Runde für die Zeitmessung (optionen.profil)
+ * GOL_PHASE beendet die laufende Phase und beginnt die nächste (-1 = keine); ohne -profil kostet es nur einen Vergleich
+ */
+enum { GOL_P_AUSTAUSCH, GOL_P_INNEN, GOL_P_WARTEN, GOL_P_RECHNEN, GOL_P_SAMMELN, GOL_P_AUSGABE, GOL_P_SICHERN, GOL_P_UMVERTEILEN, GOL_P_ZYKLUS, GOL_PHASEN };
+#define GOL_PHASE(phase, runde) do { if (optionen.profil) GOL_phase(phase, runde); } while (0)
+
 // globale SDL Variablen
 SDL_Surface *screen, *feld = NULL;
 Uint32 cellColorLife, bgColor;
-SDL_Rect cell;
 
 /**
- * SDL Initialisieren
+ * Anzeige im Demomodus: ein eigener Renderthread zeichnet, die Simulation übergibt nur fertige Bilder
+ * Ein Bildpunkt fasst faktor x faktor Zellen zusammen (Dichte der lebenden Zellen, 0 ... 255) und wird als
+ * pixel x pixel Bildschirmpixel gezeichnet; so passen auch Spielfelder, die größer als der Bildschirm sind.
+ * Drei Bildpuffer: die Simulation füllt bild[GOL_BILD_SIM], tauscht ihn mit dem bereitliegenden
+ * bild[GOL_BILD_BEREIT] und rechnet weiter; der Renderthread holt sich das jeweils neueste Bild nach
+ * bild[GOL_BILD_ZEICHNEN]. Keiner wartet auf den anderen, ist der Renderthread zu langsam, fallen Bilder aus.
  */
-void SDL_init(int _dim, int _cell_h);
+enum { GOL_BILD_SIM, GOL_BILD_BEREIT, GOL_BILD_ZEICHNEN };
+typedef struct {
+	Uint8 *bild[3]; // Dichte je Bildpunkt, n x n
+	int n; // Bildpunkte pro Zeile bzw. Spalte
+	int faktor; // Zellen pro Bildpunkt (je Richtung)
+	int pixel; // Bildschirmpixel pro Bildpunkt (je Richtung)
+	int neu; // ein neues Bild liegt bereit
+	int ende; // Renderthread beenden (nach dem letzten bereitliegenden Bild)
+	int speed; // Pause nach jedem gezeichneten Bild in Mikrosekunden
+	unsigned int *summe; // lebende Zellen je Bildpunkt einer Bildzeile (nur Simulation)
+	Uint32 farbe[256]; // Farbe je Dichte
+	SDL_Thread *thread; // Renderthread
+	SDL_mutex *mutex; // schützt bild[GOL_BILD_BEREIT], neu und ende
+	SDL_cond *cond; // neues Bild bzw. ende
+} GOL_anzeige;
+GOL_anzeige anzeige;
 
 /**
- * Fenster schließen und SDL beenden
+ * SDL Initialisieren: Fenster für ein Spielfeld mit _dim x _dim Zellen (höchstens _scr_h Pixel hoch,
+ * sonst verkleinert), Zellgröße _cell_h Pixel, Renderthread starten
+ */
+void SDL_init(int _dim, int _scr_h, int _cell_h);
+
+/**
+ * Renderthread beenden, Fenster schließen und SDL beenden
  */
 void GOL_gfx_gameover(void);
 
 /**
- * Funktion zum allozieren von zusammenhängedem Speicher für ein 2D-Integer-Array
+ * Funktion zum allozieren von zusammenhängedem, mit Nullen gefülltem Speicher für ein bitweises Spielfeld
  * MPI-Funktionen arbeiten nur mit zusammenhängendem Speicher
  */
-int **malloc2D(int _zeilen, int _spalten);
+uint64_t **malloc2D_bits(int _zeilen, int _worte);
+void free2D_bits(uint64_t **_array);
+
+/**
+ * Anzahl der Worte für eine Zeile mit _spalten Zellen (ohne die beiden Randworte)
+ * und Maske der gültigen Bits im letzten Wort einer Zeile
+ */
+int GOL_worte(int _spalten);
+uint64_t GOL_maske(int _spalten);
+
+/**
+ * Torus ohne Austausch der Randworte (die ganze Zeile liegt im eigenen Spielfeld)
+ * GOL_torus_naehen: in den Zeilen [_z_von, _z_bis) die letzte Zelle als linken Nachbarn in Randwort 0 und die erste
+ *                   Zelle als rechten Nachbarn hinter die letzte Zelle setzen (Auffüllbit bzw. Randwort _nw + 1)
+ * GOL_torus_trennen: danach Randworte und Auffüllbits wieder löschen
+ */
+void GOL_torus_naehen(uint64_t **_feld, int _z_von, int _z_bis, int _nw, int _spalten);
+void GOL_torus_trennen(uint64_t **_feld, int _z_von, int _z_bis, int _nw, uint64_t _maske);
+
+/**
+ * Regel in B/S-Schreibweise als Bitmasken der Nachbarnanzahl (Bit n = bei n Nachbarn geboren bzw. überleben)
+ * Regeln in GOL_regel_liste haben eigene, zur Übersetzungszeit spezialisierte Kernel; der letzte Eintrag
+ * ist der allgemeine Kernel, der die Masken aus GOL_regel liest
+ */
+#define GOL_REGELN 6 // Einträge in GOL_regel_liste (mit dem allgemeinen)
+typedef struct {
+	const char *name; // Name der Regel (NULL = allgemeiner Kernel)
+	int geburt, ueberleben; // Masken
+	uint64_t (*wort)(uint64_t, uint64_t, uint64_t, uint64_t, uint64_t, uint64_t, uint64_t, uint64_t, uint64_t); // Wortfunktion
+} GOL_regel_eintrag;
+struct {
+	int geburt, ueberleben; // Masken der aktiven Regel
+} GOL_regel = { 0x008, 0x00C };
+extern GOL_regel_eintrag GOL_regel_liste[GOL_REGELN];
+
+/**
+ * Bit-Addierwerk: berechnet die Worte [_von, _bis) der nächsten Generation einer Zeile
+ * aus der Zeile selbst (_mitte) und ihren Nachbarzeilen (_oben, _unten)
+ * GOL_zeile zeigt auf den beim Programmstart per CPUID gewählten Kernel (skalar, SSE2, AVX2 oder AVX-512)
+ * der aktiven Regel, GOL_wort auf die skalare Wortfunktion der Regel
+ */
+typedef struct {
+	const char *name; // Name für die Ausgabe
+	const char *isa; // benötigter Befehlssatz (NULL = keiner)
+	void (*zeile[GOL_REGELN])(const uint64_t *, const uint64_t *, const uint64_t *, uint64_t *, int, int); // Kernel je Regel
+} GOL_kernel;
+extern GOL_kernel GOL_kernel_liste[];
+extern void (*GOL_zeile)(const uint64_t *_oben, const uint64_t *_mitte, const uint64_t *_unten, uint64_t *_ziel, int _von, int _bis);
+extern uint64_t (*GOL_wort)(uint64_t, uint64_t, uint64_t, uint64_t, uint64_t, uint64_t, uint64_t, uint64_t, uint64_t);
+extern const char *GOL_kernel_name;
+void GOL_kernel_waehlen(void);
+
+/**
+ * GOL_regel_lesen: Regel aus "B3/S23" bzw. "23/3" (Überleben/Geburt) lesen, -1 = ungültig
+ * GOL_regel_waehlen: Regel aus optionen.regel aktivieren (alle Procs, nach GOL_kernel_waehlen)
+ * GOL_regel_text: Regel als "B.../S..." in _text (mindestens 22 Zeichen)
+ */
+int GOL_regel_lesen(const char *_text, int *_geburt, int *_ueberleben);
+int GOL_regel_waehlen(void);
+void GOL_regel_text(char *_text, int _geburt, int _ueberleben);
+
+/**
+ * Berechnet den Block Zeilen [_z_von, _z_bis) x Worte [_w_von, _w_bis) der nächsten Generation
+ * in einem Spielfeld mit _worte Worten pro Zeile; das letzte eigene Wort (_worte - 2) und das rechte
+ * Randwort werden dabei mit _maske bzw. _maske_rand auf die gültigen Zellen beschnitten
+ */
+void GOL_block(uint64_t **_alt, uint64_t **_neu, int _z_von, int _z_bis, int _w_von, int _w_bis, int _worte, uint64_t _maske,
+		uint64_t _maske_rand);
+
+/**
+ * Kacheln anlegen (alle gelten als geändert) und freigeben
+ * GOL_kacheln_planen: zu berechnende Kacheln der nächsten Runde bestimmen (geänderte Kacheln und ihre Nachbarn)
+ * GOL_kacheln_rand: Kacheln an der Seite _richtung zusätzlich berechnen (Überlappung hat sich geändert)
+ * GOL_kacheln_seite_geaendert: hat sich eine Kachel an der Seite _richtung in der letzten Runde geändert?
+ * GOL_kacheln_block: wie GOL_block, rechnet im eigenen Bereich aber nur die geplanten Kacheln und merkt sich
+ *                    deren Änderungen; Randzeilen und Randworte ausserhalb des eigenen Bereichs immer
+ *                    (mit optionen.zyklus wird dabei der Fingerabdruck um die geänderten Worte nachgeführt)
+ * GOL_kacheln_hash: Fingerabdruck der eigenen Zellen in den Zeilen [_z_von, _z_bis) und Worten [_w_von, _w_bis)
+ *                   eines Spielfelds; Summe über die Worte, jedes mit seiner Lage im Spielfeld gemischt, so ist
+ *                   die Summe über alle Procs unabhängig von der Aufteilung
+ */
+void GOL_kacheln_anlegen(GOL_kacheln *_k, int _z0, int _zeilen, int _worte, int _zeile0, int _wort0);
+void GOL_kacheln_freigeben(GOL_kacheln *_k);
+void GOL_kacheln_planen(GOL_kacheln *_k);
+void GOL_kacheln_rand(GOL_kacheln *_k, int _richtung);
+int GOL_kacheln_seite_geaendert(const GOL_kacheln *_k, int _richtung);
+void GOL_kacheln_block(GOL_kacheln *_k, uint64_t **_alt, uint64_t **_neu, int _z_von, int _z_bis, int _w_von, int _w_bis, int _worte,
+		uint64_t _maske, uint64_t _maske_rand);
+uint64_t GOL_kacheln_hash(const GOL_kacheln *_k, uint64_t **_feld, int _z_von, int _z_bis, int _w_von, int _w_bis);
+
+/**
+ * Zykluserkennung
+ * GOL_zyklus_merken: Fingerabdruck _hash des eigenen Bereichs nach Runde _runde merken (alle Procs, auch für die
+ *                    Anfangsgeneration); liefert 1, wenn ein Zyklus gefunden wurde (nur einmal, danach ruht die Erkennung)
+ *                    _letzte: letzte Runde, die gemerkten Fingerabdrücke werden sofort verglichen
+ */
+void GOL_zyklus_anlegen(GOL_zyklus *_z);
+int GOL_zyklus_merken(GOL_zyklus *_z, MPI_Comm _comm, int _runde, uint64_t _hash, int _letzte);
+void GOL_zyklus_freigeben(GOL_zyklus *_z);
+
+/**
+ * Anzahl der Threads pro Proc festlegen (optionen.threads bzw. Kerne des Knotens / Procs auf dem Knoten)
+ * _thread_level: von MPI_Init_thread gelieferte Thread-Unterstützung
+ */
+int GOL_threads_einrichten(MPI_Comm _comm, int _thread_level);
+
+/**
+ * Bestimmt den Nachbarn in Richtung _richtung im Prozessgitter (MPI_PROC_NULL ausserhalb nicht-periodischer Ränder)
+ */
+int GOL_nachbar(MPI_Comm _cart, const int *_dims, const int *_periods, const int *_coords, int _richtung);
+
+/**
+ * Lage der Überlappungen je Richtung für ein Teilspielfeld mit _size eigenen Zeilen und _nw eigenen Worten
+ */
+void GOL_ueberlappung_setzen(GOL_ueberlappung *_u, MPI_Datatype _zeile, MPI_Datatype _spalte, MPI_Datatype _ecke, int _halo, int _size,
+		int _nw);
+
+/**
+ * Austausch der Überlappungen (GOL_austausch)
+ * GOL_austausch_felder: beide Spielfelder mit _zeilen Zeilen zu _worte Worten anlegen (mit Nullen gefüllt), im gemeinsamen
+ *                       Fenster der Procs des Knotens, wenn optionen.fenster und _fenster gesetzt sind
+ * GOL_austausch_anlegen: dauerhafte Requests und Lage der Ränder der Nachbarn im Fenster, für die Spielfelder feld[0] und
+ *                        feld[1] (nach dem Umverteilen neu anlegen); kollektiv über _cart
+ * GOL_austausch_starten: Austausch für das Spielfeld _feld beginnen, _senden[d] = 0: unveränderten Rand leer senden
+ * GOL_austausch_beenden: auf die Nachbarn warten, Ränder aus dem Fenster kopieren; _erhalten[d] = Überlappung hat sich
+ *                        (möglicherweise) geändert. Danach lesen Nachbarn im Fenster noch den eigenen Rand, bis
+ *                        GOL_austausch_quittung zurückkehrt (vor dem Schreiben der übernächsten Generation in _feld)
+ */
+void GOL_austausch_felder(GOL_austausch *_a, MPI_Comm _cart, int _zeilen, int _worte, int _fenster);
+void GOL_austausch_anlegen(GOL_austausch *_a, MPI_Comm _cart, const int *_nachbar, const GOL_ueberlappung *_u, int _halo, int _size,
+		int _nw);
+void GOL_austausch_starten(GOL_austausch *_a, uint64_t **_feld, const int *_senden);
+void GOL_austausch_beenden(GOL_austausch *_a, uint64_t **_feld, const GOL_ueberlappung *_u, int *_erhalten);
+void GOL_austausch_quittung(GOL_austausch *_a);
+void GOL_austausch_freigeben(GOL_austausch *_a);
+void GOL_austausch_felder_freigeben(GOL_austausch *_a);
+
+/**
+ * Dynamische Lastverteilung der Zeilen (GOL_parallel mit optionen.umverteilen)
+ * GOL_grenzen_ausgleichen: neue erste Zeilen _neu der _baender Prozesszeilen aus ihren Rechenzeiten _zeiten und den
+ *                          bisherigen Grenzen _grenzen (auf allen Procs gleich); 0 = Ungleichgewicht unter der Schwelle
+ * GOL_zeilen_umziehen: Spielfeld für die neuen eigenen Zeilen [_neu_von, _neu_von + _neu_anzahl) anlegen, abgegebene
+ *                      bzw. übernommene Zeilen mit den Nachbarn _oben und _unten austauschen, altes Spielfeld freigeben
+ */
+int GOL_grenzen_ausgleichen(const double *_zeiten, const int *_grenzen, int *_neu, int _baender, int _halo, double *_ungleich);
+uint64_t **GOL_zeilen_umziehen(uint64_t **_feld, MPI_Comm _comm, int _oben, int _unten, int _halo, int _worte, int _alt_von, int _alt_anzahl,
+		int _neu_von, int _neu_anzahl);
 
 /**
  * Funktionen führen "Game Of Life" aus
  * "np = 1" -> startet serielle Version -> programmiert ohne MPI Funktionalität
  * "np > 1" -> startet parallele Version -> mit MPI Funktionen
+ * GOL_parallel gibt -1 zurück, wenn die Procs auf kein Prozessgitter über dem Spielfeld passen
  */
 double GOL_parallel(int spielfeld_dim, int _runden,  MPI_Comm comm, int _speed, int _src_h, int _cell_h);
 double GOL_seriell(int spielfeld_dim, int _runden, int _speed, int _scr_h, int _cell_h);
 
 /**
- * grafische Ausgabe des Spielfeldes mit SDL
+ * Hashlife-Variante (nur ROOT): gleiche Anfangsbedingungen und Ausgaben wie GOL_seriell, springt aber
+ * mit gemerkten Teilergebnissen um 2^n Runden, solange das Muster den toten Rand nicht erreichen kann
+ */
+double GOL_hashlife(int spielfeld_dim, int _runden, int _speed, int _scr_h, int _cell_h);
+
+/**
+ * Ausgelagerte Variante (nur ROOT, -engine datei): aktuelle und nächste Generation liegen in zwei Dateien im Format der
+ * Sicherung, die aktuelle ist nur lesend in den Speicher abgebildet. Jede Runde läuft bandweise von oben nach unten:
+ * ein Band samt Nachbarzeilen wird in ein Fenster mit Randworten kopiert, dort gerechnet und per pwrite in die andere
+ * Datei geschrieben. Das nächste Band wird vorab angefordert (MADV_WILLNEED), geschriebene Bänder werden sofort
+ * zurückgeschrieben (POSIX_FADV_DONTNEED startet unter Linux das Schreiben), gelesene aus dem Seitencache entlassen.
+ * Gleiche Anfangsbedingungen und Ergebnisse wie GOL_seriell; Schnappschüsse werden bandweise geschrieben.
+ */
+double GOL_datei(int spielfeld_dim, int _runden);
+
+/**
+ * Ensemble (alle Procs, optionen.ensemble Bretter): viele unabhängige kleine Spielfelder _dim x _dim mit totem Rand,
+ * jedes bis zu einem Zyklus (Periode bis optionen.zyklus, sonst 30) oder höchstens _runden Runden. Brett b hat die
+ * Saat optionen.saat + b, lässt sich also mit -saat und -dim einzeln nachrechnen. Die Bretter werden über einen
+ * Zähler bei ROOT (MPI_Fetch_and_op) blockweise an die Procs vergeben, dort an die Threads; jeder Thread rechnet
+ * mehrere Bretter nebeneinander in einem Streifen. ROOT schreibt eine CSV-Zeile pro Brett. Liefert die Rechenzeit.
+ */
+double GOL_ensemble(MPI_Comm _comm, int _dim, int _runden);
+
+/**
+ * Hashlife-Grundfunktionen:
+ * GOL_hl_blatt / GOL_hl_knoten liefern den kanonischen Knoten (neu angelegt oder aus der Hashtabelle),
+ * GOL_hl_schritt die Mitte eines Knotens der Ebene n nach 2^_schritt Runden (_schritt <= n - 2),
+ * GOL_hl_aufraeumen gibt alle von _wurzel aus nicht erreichbaren Knoten frei
+ */
+GOL_knoten *GOL_hl_blatt(uint64_t _bits);
+GOL_knoten *GOL_hl_knoten(GOL_knoten *_nw, GOL_knoten *_no, GOL_knoten *_sw, GOL_knoten *_so);
+GOL_knoten *GOL_hl_schritt(GOL_knoten *_knoten, int _schritt);
+void GOL_hl_aufraeumen(GOL_knoten *_wurzel);
+
+/**
+ * grafische Ausgabe des Spielfeldes mit SDL: Dichtebild berechnen und an den Renderthread übergeben
+ * (_speed = Mindestabstand der gezeichneten Bilder in Mikrosekunden)
+ */
+void GOL_gfx(uint64_t **spielfeld, int _dim, int _speed);
+int GOL_gfx_zeichnen(void *_daten);
+
+/**
+ * Kommandozeilenoptionen lesen (nur ROOT)
+ * GOL_option setzt eine Option (Name ohne Minus), 0 = unbekannte Option
+ * GOL_konfig_lesen liest Optionen aus einer Datei ("name wert" pro Zeile)
+ */
+void GOL_optionen_lesen(int argc, char *argv[]);
+int GOL_option(const char *_name, const char *_wert);
+int GOL_konfig_lesen(const char *_datei);
+
+/**
+ * Benchmark (alle Procs): starke und schwache Skalierung über optionen.bench_dims x optionen.bench_runden,
+ * je Prozessanzahl 1, 2, 4, ..., N ein Teilkommunikator; ROOT schreibt pro Messpunkt eine CSV-Zeile
+ */
+void GOL_benchmark(MPI_Comm _comm, int _threads);
+
+/**
+ * Kernel-Messung (nur ROOT, -benchmark kernel): jeder vom Prozessor unterstützte Kernel der aktiven Regel allein
+ * auf Spielfeldern, die in L1, L2, L3 bzw. nur in den Hauptspeicher passen; ROOT schreibt Zellen pro ns als CSV
+ */
+void GOL_kernel_messen(FILE *_aus);
+
+/**
+ * Prüfung (alle Procs, -pruefen 1): für jede Dimension und Rundenanzahl aus den Listen des Benchmarks rechnet ROOT
+ * die serielle Version, dann die ersten p Procs (p = 1 ... N) die parallele auf demselben Anfangsspielfeld;
+ * ROOT vergleicht die Endspielfelder Bit für Bit. Liefert bei ROOT die Anzahl der abweichenden Läufe.
+ */
+int GOL_pruefen(MPI_Comm _comm);
+
+/**
+ * Entscheidet, ob das Vollspielfeld nach Runde _runde gebraucht wird (Demomodus, Schnappschuss, letzte Runde)
+ * und verarbeitet es bei ROOT (Grafik, PBM-Datei, Anzahl der lebenden Zellen)
+ */
+int GOL_voll_noetig(int _runde, int _runden);
+/**
+ * Demomodus: stimmt vor GOL_voll_noetig ab, ob der Renderthread bei ROOT das letzte Bild schon übernommen hat
+ * (MPI_Bcast über _comm, MPI_COMM_NULL = nur ein Proc); nur dann wird für ein neues Bild gesammelt
+ */
+void GOL_bild_abstimmen(MPI_Comm _comm);
+extern uint64_t **GOL_ergebnis; // nur ROOT (GOL_pruefen): hierhin wird das Endspielfeld kopiert (NULL = nicht)
+void GOL_voll_ausgeben(uint64_t **_voll, int _dim, int _runde, int _runden, int _speed);
+void GOL_voll_auspacken(uint64_t **_voll, const uint64_t *_sammel, int _nprocs, const int *_size, const int *_offset, const int *_nw,
+		const int *_wortoffset);
+
+/**
+ * Zeitmessung pro Phase (alle Procs des Kommunikators, nur mit optionen.profil)
+ * GOL_profil_start: Zähler zurücksetzen, Hardwarezähler öffnen, gemeinsamer Start an einer Barriere
+ * GOL_phase: Phasenwechsel in Runde _runde (über das Makro GOL_PHASE)
+ * GOL_profil_ende: Phasenzeiten über alle Procs auswerten (ROOT gibt aus), Spurdatei schreiben
+ */
+void GOL_profil_start(MPI_Comm _comm);
+void GOL_phase(int _phase, int _runde);
+void GOL_profil_ende(MPI_Comm _comm);
+
+/**
+ * Zufällige Anfangsbedingungen: jedes Wort hängt nur von optionen.saat, optionen.dichte und seiner Lage im Spielfeld ab,
+ * jede Prozessanzahl (und die serielle Version) erzeugt also dasselbe Spielfeld
+ * GOL_philox: Philox4x32-10, zählerbasierter Zufallsgenerator (128 Bits aus Zähler und Schlüssel, ohne Zustand)
+ * GOL_zufall_wort: 64 Zellen des Wortes _wort (ab 0) in Zeile _zeile (ab 0) zur Saat _saat, lebendig mit
+ *                  Wahrscheinlichkeit _dichte / 65536
+ * GOL_zufall_fuellen: eigene Zeilen [_zeile0, _zeile0 + _zeilen) des Spielfelds, Worte ab _wort0, in _feld ab Zeile _z
+ *                     füllen (_spalten eigene Zellen pro Zeile); die Threads füllen je einen Teil der Zeilen und
+ *                     berühren dabei auch die Zeilen von _zwischen (falls nicht NULL) als erste, so liegen die
+ *                     Speicherseiten bei dem Kern, der die Zeilen später rechnet
+ */
+void GOL_philox(uint32_t _zaehler[4], uint64_t _schluessel);
+uint64_t GOL_zufall_wort(uint64_t _saat, int _zeile, int _wort, int _dichte);
+void GOL_zufall_fuellen(uint64_t **_feld, uint64_t **_zwischen, int _z, int _zeilen, int _nw, int _spalten, int _zeile0, int _wort0);
+
+/**
+ * Anfangsbedingungen aus einer Musterdatei (RLE oder .cells, alle Procs von _comm)
+ * Spielfeldzeilen [_z_von, _z_von + _z_anzahl) und -spalten [_s_von, _s_von + _s_anzahl) (ab 0) des Procs
+ * stehen in _feld ab Zeile _zeile0 bzw. ab Zelle 1; liefert 0 bzw. -1 bei Fehlern (auf allen Procs gleich)
+ */
+int GOL_muster_laden(const char *_datei, MPI_Comm _comm, int _dim, uint64_t **_feld, int _zeile0, int _z_von, int _z_anzahl, int _s_von,
+		int _s_anzahl);
+
+/**
+ * Sicherung und Fortsetzen (alle Procs von _comm, kollektives MPI-IO)
+ * GOL_sicherung_faellig: wird nach Runde _runde regelmäßig gesichert?
+ * GOL_signal_fangen: Signal-Handler, zählt GOL_signal hoch (bei SIGTERM auch GOL_signal_ende)
+ * GOL_sicherung_schreiben: eigenen Block (Zeilen [_z_von, ...) und Worte [_w_von, ...) des Spielfelds, in _feld ab
+ *                          Zeile _zeile0 und Wort 1) kopieren und im Hintergrund in die Sicherungsdatei schreiben
+ * GOL_sicherung_testen / GOL_sicherung_abschliessen: Schreiben voranbringen bzw. abwarten, Datei an ihren Platz
+ * GOL_sicherung_kopf: Dimension und Runde einer Sicherung lesen (nur ROOT), -1 = keine gültige Sicherung
+ * GOL_sicherung_laden: eigenen Block aus der Sicherung lesen (_worte = Worte pro Zeile in _feld)
+ */
+int GOL_sicherung_faellig(int _runde);
+void GOL_signal_fangen(int _signal);
+void GOL_sicherung_schreiben(GOL_sicherung *_s, MPI_Comm _comm, uint64_t **_feld, int _zeile0, int _dim, int _z_von, int _z_anzahl, int _w_von,
+		int _w_anzahl, int _runde);
+void GOL_sicherung_testen(GOL_sicherung *_s);
+void GOL_sicherung_abschliessen(GOL_sicherung *_s);
+int GOL_sicherung_kopf(const char *_datei, int *_dim, int *_runde);
+int GOL_sicherung_laden(const char *_datei, MPI_Comm _comm, uint64_t **_feld, int _zeile0, int _worte, int _dim, int _z_von, int _z_anzahl,
+		int _w_von, int _w_anzahl);
+
+/**
+ * Anzahl der lebenden Zellen in den Zeilen 1 ... _zeilen, Worte 1 ... _nw
+ * und Speichern eines Spielfelds als PBM-Bild
  */
-void GOL_gfx(int **spielfeld, int _dim);
+long long GOL_lebende(uint64_t **_feld, int _zeilen, int _nw);
+int GOL_pbm_schreiben(const char *_datei, uint64_t **_feld, int _dim);
 
 /**
  * MAIN
@@ -94,18 +759,71 @@ int main(int argc, char *argv[]) {
 	int dim; // Spielfelddimesnion dim x dim
 	int runden; // Spielrundenanzahl
 	int nprocs; // Prozessanzahl
-	double zeit; // Ausführungszeit des Rechen-Algotithmus
-	int speed; // Spielgeschwindigkeit, entspricht Intervall für das Leeren der Konsole
+	double zeit = 0; // Ausführungszeit des Rechen-Algotithmus
+	int speed = 0; // Spielgeschwindigkeit, entspricht Intervall für das Leeren der Konsole
+	int stapel; // Stapelbetrieb: Dimension und Runden stehen in der Kommandozeile, keine Abfragen
 	char processorName[MPI_MAX_PROCESSOR_NAME]; // Processorname
 	int processorNameMax, majorVersion, minorVersion; // Maximale Zeichenanzahl im Processornamen, MPI major- und minor-Version
+	int thread_level; // Thread-Unterstützung der MPI-Bibliothek
+	int threads; // Threads pro Proc
+	char regel_text[24]; // Regel für die Anzeige
+	int fehler = 0; // abweichende Läufe der Prüfung (nur ROOT) bzw. kein Prozessgitter
 
 	// MPI Initialisieren und Systeminfos abfragen
-	MPI_Init(&argc, &argv);
+	// MPI-Aufrufe kommen nur aus dem Hauptthread, die Threads rechnen nur (MPI_THREAD_FUNNELED)
+	MPI_Init_thread(&argc, &argv, MPI_THREAD_FUNNELED, &thread_level);
 	MPI_Comm_rank(MPI_COMM_WORLD, &my_rank);
 	MPI_Comm_size(MPI_COMM_WORLD, &nprocs);
 	MPI_Get_processor_name(processorName, &processorNameMax);
 	MPI_Get_version(&majorVersion, &minorVersion);
 
+	// Kommandozeilenoptionen lesen, an alle Procs geht die Struktur weiter unten per MPI_Bcast
+	if (my_rank == ROOT) {
+		GOL_optionen_lesen(argc, argv);
+		if (!optionen.saat_gesetzt) optionen.saat = (unsigned long long) time(NULL);
+
+		// Fortsetzen: Dimension und erste Runde stehen in der Sicherung
+		if (optionen.fortsetzen[0] != '\0' && GOL_sicherung_kopf(optionen.fortsetzen, &optionen.dim, &optionen.start_runde) != 0)
+			optionen.fortsetzen[0] = '\0';
+
+		// ungültige Regel: mit Conway weiterspielen
+		if (optionen.regel[0] != '\0' && GOL_regel_lesen(optionen.regel, &GOL_regel.geburt, &GOL_regel.ueberleben) != 0) {
+			printf("Error: ungültige Regel %s, gespielt wird B3/S23\n", optionen.regel);
+			optionen.regel[0] = '\0';
+			GOL_regel.geburt = 0x008;
+			GOL_regel.ueberleben = 0x00C;
+		}
+
+		// Hashlife kennt nur den toten Rand und keine Geburt ohne Nachbarn (B0 füllt den unendlichen Raum)
+		if (optionen.engine == GOL_HASHLIFE && (optionen.torus || (GOL_regel.geburt & 1))) {
+			printf("Error: Hashlife rechnet weder auf dem Torus noch mit B0-Regeln, gerechnet wird mit Stencil\n");
+			optionen.engine = GOL_STENCIL;
+		}
+
+		// Ensemble: Zufallswerte mit totem Rand, keine Sicherung
+		if (optionen.ensemble > 0) {
+			if (optionen.torus || optionen.muster[0] != '\0' || optionen.fortsetzen[0] != '\0' || optionen.sicherung != 0)
+				printf("Error: das Ensemble rechnet nur Zufallswerte mit totem Rand ohne Sicherung\n");
+			optionen.torus = 0;
+			optionen.muster[0] = optionen.fortsetzen[0] = '\0';
+			optionen.sicherung = 0;
+		}
+
+		// ausgelagertes Spielfeld (nicht im Ensemble): die Dateien sind selbst die Sicherung, gesichert wird nicht zusätzlich
+		// (nur das Signal gilt)
+		if (optionen.engine == GOL_DATEI && !GOL_MMAP) {
+			printf("Error: -engine datei gibt es nur unter POSIX, gerechnet wird mit Stencil\n");
+			optionen.engine = GOL_STENCIL;
+		}
+		if (optionen.engine == GOL_DATEI && optionen.ensemble == 0) {
+			if (optionen.sicherung > 0) printf("Error: mit -engine datei ist die Spielfelddatei die Sicherung, -sicherung entfällt\n");
+			optionen.sicherung = -1;
+		}
+	}
+
+	// schnellsten Kernel für diesen Prozessor wählen (jeder Proc für sich, Knoten können verschieden sein)
+	GOL_kernel_waehlen();
+
 	/**
 	 * NUR ROOT-Prozess:
 	 * - Abfrage von Spielrunden und Spielfeldgröße
@@ -120,28 +838,75 @@ int main(int argc, char *argv[]) {
 			printf("%s\nMPI Version %d.%d bereit\n", processorName, majorVersion, minorVersion);
 			printf("-[\033[31m parallele Version\033[m ]-[\033[1m %d Prozesse \033[m]-\n\n", nprocs);
 		}
+		printf("Kernel: %s\n", GOL_kernel_name);
+		printf("Engine: %s\n", optionen.engine == GOL_HASHLIFE ? "Hashlife" : (optionen.engine == GOL_DATEI) ? "Datei" : "Stencil");
+		GOL_regel_text(regel_text, GOL_regel.geburt, GOL_regel.ueberleben);
+		printf("Regel: %s, Rand: %s\n\n", regel_text, optionen.torus ? "Torus" : "tot");
+		if (optionen.fortsetzen[0] != '\0') printf("Fortsetzen aus %s ab Runde %d\n\n", optionen.fortsetzen, optionen.start_runde);
+		else if (optionen.muster[0] == '\0') printf("Zufallswerte: Saat %llu, Dichte %.3f\n\n", optionen.saat, optionen.dichte);
 
-		// Spielparameter abfragen
-		printf("Ihre Bildschirmhöhe eingeben \033[36m(z.B. 800)\033[m:\n");
-		scanf("%d", &scr_h);
-		printf("Die Größe einer Zelle eingeben \033[36m(z.B. 5)\033[m:\n");
-		scanf("%d", &cell_h);
-		printf("Die Dimension des Spielfelds eingeben \033[36m(z.B. 1000)\033[m:\n[\033[1m\033[31mDemomodus max. \033[5m%d\033[25m\033[m]\n", scr_h / cell_h);
-		scanf("%d", &dim);
-		printf("Die Anzahl der Spielrunden eingeben \033[36m(z.B. 100):\033[m \n");
-		scanf("%d", &runden);
-		printf("\n");
+		/**
+		 * Spielparameter aus der Kommandozeile übernehmen, fehlende abfragen
+		 * (im Stapelbetrieb und im Benchmark gelten für die Anzeige Standardwerte)
+		 */
+		stapel = (optionen.dim > 0 && optionen.runden > 0) || optionen.benchmark || optionen.pruefen;
+		if (optionen.hoehe > 0) scr_h = optionen.hoehe;
+		else if (stapel) scr_h = 800;
+		else {
+			printf("Ihre Bildschirmhöhe eingeben \033[36m(z.B. 800)\033[m:\n");
+			scanf("%d", &scr_h);
+		}
+		if (optionen.zelle > 0) cell_h = optionen.zelle;
+		else if (stapel) cell_h = 5;
+		else {
+			printf("Die Größe einer Zelle eingeben \033[36m(z.B. 5)\033[m:\n");
+			scanf("%d", &cell_h);
+		}
+		if (optionen.benchmark || optionen.pruefen) {
+			dim = runden = 0; // Dimensionen und Runden kommen aus den Listen des Benchmarks
+		} else {
+			if (optionen.dim > 0) dim = optionen.dim;
+			else {
+				printf("Die Dimension des Spielfelds eingeben \033[36m(z.B. 1000)\033[m:\n[\033[1m\033[31mDemomodus max. \033[5m%d\033[25m\033[m]\n", scr_h / cell_h);
+				scanf("%d", &dim);
+			}
+			if (optionen.runden > 0) runden = optionen.runden;
+			else {
+				printf("Die Anzahl der Spielrunden eingeben \033[36m(z.B. 100):\033[m \n");
+				scanf("%d", &runden);
+			}
+			printf("\n");
+		}
 
 		/**
 		 * Aktiviert ggf. den Demomodus
+		 * automatisch nur im Dialog, im Stapelbetrieb nur mit -demo 1 (kein Fenster auf Rechenknoten)
+		 * automatisch nur, wenn das Spielfeld auf den Bildschirm passt; mit -demo 1 auch größere Spielfelder (verkleinert)
 		 */
-		if (dim <= scr_h / cell_h) {
+		if (optionen.demo < 0) optionen.demo = !stapel && dim <= scr_h / cell_h;
+		optionen.demo = optionen.demo && !optionen.benchmark && !optionen.pruefen && optionen.ensemble == 0 && optionen.engine != GOL_DATEI;
+		if (optionen.demo) {
 			printf("\033[35m-[ Demomodus ]-\033[m\n");
-			printf("Die Spielgeschwindigkeit in Millisekunden eingeben \033[36m(z.B. 500):\033[m \n");
-			scanf("%d", &speed); // Spielgeschwindigkeit
-			printf("\n");
+			if (optionen.speed > 0) speed = optionen.speed;
+			else if (stapel) speed = 500;
+			else {
+				printf("Die Spielgeschwindigkeit in Millisekunden eingeben \033[36m(z.B. 500):\033[m \n");
+				scanf("%d", &speed); // Spielgeschwindigkeit
+				printf("\n");
+			}
 			speed *= 1000; // für utime(): Millisekunden in Microsekunden umrechnen
-			SDL_init(dim, cell_h); // Die grafische Schnittstelle initialisieren
+			SDL_init(dim, scr_h, cell_h); // Die grafische Schnittstelle initialisieren
+		}
+
+		// im Benchmark nur messen: kein Sammeln des Ergebnisses oder von Schnappschüssen, keine Statistik pro Lauf
+		// (beim Prüfen wird das Endspielfeld trotzdem gesammelt)
+		if (optionen.benchmark || optionen.pruefen) {
+			optionen.ausgabe = 0;
+			optionen.schnappschuss = 0;
+			optionen.profil = 0;
+			optionen.sicherung = 0;
+			optionen.fortsetzen[0] = '\0';
+			optionen.zyklus = 0;
 		}
 	}
 
@@ -150,23 +915,64 @@ int main(int argc, char *argv[]) {
 		 * Broadcast der relevanten Daten von Proc ROOT an alle anderen:
 		 * runden = Spielrunden
 		 * dim = Spielfelddimension (dim x dim)
+		 * optionen = Demomodus und Kommandozeilenoptionen (alle Procs müssen wissen, wann gesammelt wird)
 		 */
 		MPI_Bcast(&dim, 1, MPI_INT, ROOT, MPI_COMM_WORLD);
 		MPI_Bcast(&runden, 1, MPI_INT, ROOT, MPI_COMM_WORLD);
+		MPI_Bcast(&optionen, sizeof(GOL_optionen), MPI_BYTE, ROOT, MPI_COMM_WORLD);
+	}
 
-		/**
-		 * Game Of Life starten
-		 * zeit = gesamte Rechnezeit
-		 */
+	// Regel aktivieren (ROOT hat sie bereits geprüft)
+	GOL_regel_waehlen();
+
+	// Signale abfangen, damit vor dem Beenden noch gesichert wird
+	if (optionen.sicherung != 0) {
+		signal(SIGTERM, GOL_signal_fangen);
+#ifdef SIGUSR1
+		signal(SIGUSR1, GOL_signal_fangen);
+#endif
+	}
+
+	// Threads pro Proc festlegen (alle Procs kennen jetzt optionen.threads)
+	threads = GOL_threads_einrichten(MPI_COMM_WORLD, thread_level);
+	if (my_rank == ROOT) printf("Threads pro Proc: %d\n", threads);
+
+	/**
+	 * Game Of Life starten
+	 * zeit = gesamte Rechnezeit
+	 */
+	if (optionen.pruefen) {
+		// parallele gegen serielle Version, ROOT meldet jede Abweichung
+		fehler = GOL_pruefen(MPI_COMM_WORLD);
+	} else if (optionen.benchmark) {
+		// Skalierungsmessung auf Teilkommunikatoren, die Ergebnisse schreibt ROOT als CSV
+		GOL_benchmark(MPI_COMM_WORLD, threads);
+	} else if (optionen.ensemble > 0) {
+		// viele kleine Bretter, verteilt über alle Procs und Threads
+		zeit = GOL_ensemble(MPI_COMM_WORLD, dim, runden);
+	} else if (optionen.engine == GOL_HASHLIFE) {
+		// Hashlife rechnet seriell bei ROOT, die übrigen Procs haben nichts zu tun
+		if (my_rank == ROOT) {
+			printf("Proc %d: rechne (Hashlife) ...\n", my_rank);
+			zeit = GOL_hashlife(dim, runden, speed, scr_h, cell_h);
+		}
+	} else if (optionen.engine == GOL_DATEI) {
+		// das Spielfeld liegt in Dateien, ROOT rechnet es bandweise durch den Speicher
+		if (my_rank == ROOT) {
+			printf("Proc %d: rechne (Datei) ...\n", my_rank);
+			zeit = GOL_datei(dim, runden);
+		}
+	} else if (nprocs > 1) {
 		printf("Proc %d: rechne ...\n", my_rank);
 		zeit = GOL_parallel(dim, runden, MPI_COMM_WORLD, speed, scr_h, cell_h);
+		if (zeit < 0) fehler = 1;
 	} else if (nprocs == 1) {
 		printf("Proc %d: rechne ...\n", my_rank);
 		zeit = GOL_seriell(dim, runden, speed, scr_h, cell_h);
 	}
 
 	// Ausgabe der gesamten Rechenzeit
-	if (my_rank == ROOT) {
+	if (my_rank == ROOT && !optionen.benchmark && !optionen.pruefen && fehler == 0) {
 		printf("\n\"Game Of Life\" beendet\nLaufzeit: \033[31m%lf Sekunden\033[m\n\033[7m----------------------------------------\033[m\n\n", zeit);
 		// ggf. SDL beenden
 		if (screen != NULL) {
@@ -179,225 +985,3221 @@ int main(int argc, char *argv[]) {
 	// MPI beenden
 	MPI_Finalize();
 
-	// Programmende
-	return EXIT_SUCCESS;
+	// Programmende (Prüfung mit Abweichungen bzw. kein Prozessgitter: Fehler)
+	return (fehler > 0) ? EXIT_FAILURE : EXIT_SUCCESS;
 }
 
 /**
- * Alloziert Speicherplatz für ein 2D-Integer-Array
- * _zeilen = Zeilen in Matrix
- * _spalten = Spalten in Matrix
+ * Liest die Kommandozeilenoptionen in die globale Struktur optionen
+ * unbekannte Optionen werden gemeldet und übersprungen
  */
-int **malloc2D(int _zeilen, int _spalten) {
+void GOL_optionen_lesen(int argc, char *argv[]) {
 	int i; // für Schleife
-	int *daten = (int *) malloc(_zeilen * _spalten * sizeof(int)); // Pointer auf Speicherstelle mit (N x N)-Integer
-	int **array = (int **) malloc(_zeilen * sizeof(int*)); // Pointer auf N-mal Integer Pointer
-	for (i = 0; i < _zeilen; i++)
-		array[i] = &(daten[_spalten * i]); // Jedem der vorher difiniertem Pointer einen Speicherberich festlegen
-	return array; // Pinter die Speicherstelle mit NxN-Integer zurückgeben
+	for (i = 1; i < argc; i++) {
+		if (argv[i][0] != '-' || i + 1 >= argc) {
+			printf("Unbekannte Option: %s\n", argv[i]);
+		} else if (strcmp(argv[i], "-konfig") == 0) {
+			GOL_konfig_lesen(argv[++i]);
+		} else if (!GOL_option(argv[i] + 1, argv[i + 1])) {
+			printf("Unbekannte Option: %s\n", argv[i]);
+		} else {
+			i++;
+		}
+	}
 }
 
 /**
- * Funktion: parallele MPI-Version von "Game Of Life"
- * - zwei oder mehr Prozesse sind aktiv
- *
- * 1) Variablen Difinitionen
- * 2) MPI Daten abfragen
- * 3) Die Nachbarn OBEN und UNTEN bestimmen
- * 4) eigene Spielfeldgröße bestimmen (pro Prozess eigenes Teilspielfeld)
- * 5) Speicher für Spielfelder allozieren
- * 6) Spielfelder initialisieren (Anfangsbedingungen)
- * 7) Spiel runden-Mal spielen
- * 8) Rechenzeit aller Procs zusammentragen und zurückgeben
- *
- * Parameter:
- *  spielfeld_dim: Teilspielfeld X-Dimension
- *  _runden: Anzahl derSpielrunden
- *  _speed: Verzögerung zwischen Spielrunden
- *  _scr_h: Bildschirmhöhe
- *  _cell_h: Höhe der Zelle
- *  comm: MPI Kommunikator
+ * Kommagetrennte Liste von Zahlen lesen (höchstens _max), liefert die Anzahl
  */
-double GOL_parallel(int spielfeld_dim, int _runden, MPI_Comm comm, int _speed, int _scr_h, int _cell_h) {
-	// Variablen
-	int my_rank; // eigene Prozess-ID
-	int nprocs; // Prozessanzahl
-	int sende_oben, sende_unten, hole_oben, hole_unten; // Nachbarn OBEN und UNTEN
-	int i, j, k; // für diverse Schleifen
-	int my_size; // eigene Y_Teilspielfelddimension
-	int my_elements; // Anzahl der Elemente in eigenem Teilspielfeld
-	int my_offset; // Offset in dem Spielfeld
-	int *all_size; // Size-Array mit my_size der einzelnen Procs
-	int *all_elements; // Elements-Array mit my_elements der einzelnen Procs
-	int *all_offset; // Offset-Array mit my_offset der einzelnen Procs
-	int nachbarn; // Summe der Nachbarn
-	int **my_spielfeld, **my_zwischen, **my_swap, **voll = NULL; // für Spielfelder
-	double proc_zeit, max_zeit; // für Berechnung der Ausführungszeit -> Ausführungszeit jedes Prozesses und die längste Ausführungszeit
-
-	// Prozessanzahl und eigene Prozess-ID bestimmen
-	// (könnte auch über Parameter übergeben werden, aber Übersichtlichkeitshalber hier nochmal difiniert)
-	MPI_Comm_size(comm, &nprocs);
-	MPI_Comm_rank(comm, &my_rank);
+static int GOL_liste_lesen(const char *_wert, int *_liste, int _max) {
+	int n = 0; // Anzahl
+	char *ende; // Ende der gelesenen Zahl
+	while (*_wert != '\0' && n < _max) {
+		_liste[n] = (int) strtol(_wert, &ende, 10);
+		if (ende == _wert) break;
+		if (_liste[n] > 0) n++;
+		_wert = (*ende == ',') ? ende + 1 : ende;
+	}
+	return n;
+}
 
-	// Bestimmung der Nachbar-Teilspielfelder OBEN und UNTEN
-	if (my_rank == ROOT) {
-		sende_oben = hole_oben = MPI_PROC_NULL; // OBEN ist kein Teilspielfeld vorhanden
-		sende_unten = hole_unten = my_rank + 1; // sende nach UNTEN und hole von UNTEN
-	} else if (my_rank == nprocs - 1) {
-		sende_unten = hole_unten = MPI_PROC_NULL; // UNTEN ist kein Teilspielfeld vorhanden
-		sende_oben = hole_oben = nprocs - 2; // sende nach OBEN und hole von OBEN
+int GOL_option(const char *_name, const char *_wert) {
+	if (strcmp(_name, "schnappschuss") == 0) {
+		optionen.schnappschuss = atoi(_wert);
+	} else if (strcmp(_name, "halo") == 0) {
+		optionen.halo = atoi(_wert);
+	} else if (strcmp(_name, "engine") == 0) {
+		if (strcmp(_wert, "hashlife") == 0) optionen.engine = GOL_HASHLIFE;
+		else if (strcmp(_wert, "stencil") == 0) optionen.engine = GOL_STENCIL;
+		else if (strcmp(_wert, "datei") == 0) optionen.engine = GOL_DATEI;
+		else printf("Unbekanntes Rechenverfahren: %s\n", _wert);
+	} else if (strcmp(_name, "kacheln") == 0) {
+		optionen.kacheln = atoi(_wert) != 0;
+	} else if (strcmp(_name, "threads") == 0) {
+		optionen.threads = atoi(_wert);
+	} else if (strcmp(_name, "hl_speicher") == 0) {
+		optionen.hl_speicher = atoi(_wert);
+		if (optionen.hl_speicher < 1) optionen.hl_speicher = 1;
+	} else if (strcmp(_name, "dim") == 0) {
+		optionen.dim = atoi(_wert);
+	} else if (strcmp(_name, "runden") == 0) {
+		optionen.runden = atoi(_wert);
+	} else if (strcmp(_name, "hoehe") == 0) {
+		optionen.hoehe = atoi(_wert);
+	} else if (strcmp(_name, "zelle") == 0) {
+		optionen.zelle = atoi(_wert);
+	} else if (strcmp(_name, "speed") == 0) {
+		optionen.speed = atoi(_wert);
+	} else if (strcmp(_name, "demo") == 0) {
+		optionen.demo = atoi(_wert) != 0;
+	} else if (strcmp(_name, "benchmark") == 0) {
+		if (strcmp(_wert, "stark") == 0) optionen.benchmark = GOL_STARK;
+		else if (strcmp(_wert, "schwach") == 0) optionen.benchmark = GOL_SCHWACH;
+		else if (strcmp(_wert, "beide") == 0) optionen.benchmark = GOL_STARK | GOL_SCHWACH;
+		else if (strcmp(_wert, "kernel") == 0) optionen.benchmark = GOL_KERNEL;
+		else printf("Unbekannte Benchmark-Art: %s\n", _wert);
+	} else if (strcmp(_name, "bench_dims") == 0) {
+		optionen.bench_n_dims = GOL_liste_lesen(_wert, optionen.bench_dims, 16);
+	} else if (strcmp(_name, "bench_runden") == 0) {
+		optionen.bench_n_runden = GOL_liste_lesen(_wert, optionen.bench_runden, 16);
+	} else if (strcmp(_name, "bench_wdh") == 0) {
+		optionen.bench_wdh = atoi(_wert);
+		if (optionen.bench_wdh < 1) optionen.bench_wdh = 1;
+	} else if (strcmp(_name, "bench_aufwaermen") == 0) {
+		optionen.bench_aufwaermen = atoi(_wert);
+		if (optionen.bench_aufwaermen < 0) optionen.bench_aufwaermen = 0;
+	} else if (strcmp(_name, "bench_datei") == 0) {
+		snprintf(optionen.bench_datei, sizeof(optionen.bench_datei), "%s", _wert);
+	} else if (strcmp(_name, "profil") == 0) {
+		optionen.profil = atoi(_wert);
+		if (optionen.profil < 0) optionen.profil = 0;
+		if (optionen.profil > 2) optionen.profil = 2;
+	} else if (strcmp(_name, "muster") == 0) {
+		snprintf(optionen.muster, sizeof(optionen.muster), "%s", _wert);
+	} else if (strcmp(_name, "versatz") == 0) {
+		optionen.versatz_gesetzt = sscanf(_wert, "%d,%d", &optionen.versatz[0], &optionen.versatz[1]) == 2;
+		if (!optionen.versatz_gesetzt) printf("Versatz erwartet als X,Y: %s\n", _wert);
+	} else if (strcmp(_name, "sicherung") == 0) {
+		optionen.sicherung = (strcmp(_wert, "signal") == 0) ? -1 : atoi(_wert);
+	} else if (strcmp(_name, "sicherung_datei") == 0) {
+		snprintf(optionen.sicherung_datei, sizeof(optionen.sicherung_datei), "%s", _wert);
+	} else if (strcmp(_name, "fortsetzen") == 0) {
+		snprintf(optionen.fortsetzen, sizeof(optionen.fortsetzen), "%s", _wert);
+	} else if (strcmp(_name, "saat") == 0) {
+		optionen.saat = strtoull(_wert, NULL, 10);
+		optionen.saat_gesetzt = 1;
+	} else if (strcmp(_name, "dichte") == 0) {
+		optionen.dichte = atof(_wert);
+		if (optionen.dichte > 1) optionen.dichte /= 100; // auch in Prozent
+	} else if (strcmp(_name, "ensemble") == 0) {
+		optionen.ensemble = atoll(_wert);
+	} else if (strcmp(_name, "ensemble_breite") == 0) {
+		optionen.ensemble_breite = atoi(_wert);
+	} else if (strcmp(_name, "ensemble_datei") == 0) {
+		snprintf(optionen.ensemble_datei, sizeof(optionen.ensemble_datei), "%s", _wert);
+	} else if (strcmp(_name, "datei_praefix") == 0) {
+		snprintf(optionen.datei_praefix, sizeof(optionen.datei_praefix), "%s", _wert);
+	} else if (strcmp(_name, "datei_fenster") == 0) {
+		optionen.datei_fenster = atoi(_wert);
+		if (optionen.datei_fenster < 1) optionen.datei_fenster = 1;
+	} else if (strcmp(_name, "pruefen") == 0) {
+		optionen.pruefen = atoi(_wert) != 0;
+	} else if (strcmp(_name, "fenster") == 0) {
+		optionen.fenster = atoi(_wert) != 0;
+	} else if (strcmp(_name, "zyklus") == 0) {
+		optionen.zyklus = atoi(_wert);
+	} else if (strcmp(_name, "zyklus_ende") == 0) {
+		optionen.zyklus_ende = atoi(_wert);
+	} else if (strcmp(_name, "regel") == 0) {
+		snprintf(optionen.regel, sizeof(optionen.regel), "%s", _wert);
+	} else if (strcmp(_name, "rand") == 0) {
+		if (strcmp(_wert, "torus") == 0) optionen.torus = 1;
+		else if (strcmp(_wert, "tot") == 0) optionen.torus = 0;
+		else printf("Unbekannter Rand: %s\n", _wert);
+	} else if (strcmp(_name, "umverteilen") == 0) {
+		optionen.umverteilen = atoi(_wert);
+		if (optionen.umverteilen < 0) optionen.umverteilen = 0;
+	} else if (strcmp(_name, "umverteilen_schwelle") == 0) {
+		optionen.umverteilen_schwelle = atoi(_wert);
+		if (optionen.umverteilen_schwelle < 0) optionen.umverteilen_schwelle = 0;
+	} else if (strcmp(_name, "spur") == 0) {
+		snprintf(optionen.spur, sizeof(optionen.spur), "%s", _wert);
+		if (optionen.profil == 0) optionen.profil = 1;
 	} else {
-		sende_oben = hole_oben = my_rank - 1; // sende nach OBEN und hole von OBEN
-		sende_unten = hole_unten = my_rank + 1; // sende nach UNTEN und hole von UNTEN
+		return 0;
 	}
+	return 1;
+}
 
-	// eigene Y-Teilspielfeddimension bestimmen
-	my_size = spielfeld_dim / nprocs + ((my_rank < (spielfeld_dim % nprocs)) ? 1 : 0);
-	// eigene Anzahl der Elemente ohne obere und untere Zeile (Überlappung bzw. NULL-Zeile) bestimmen (jeder Proc für sich)
-	my_elements = my_size * (spielfeld_dim + 2);
-
-	// Offset bestimmen (jeder Proc für sich)
-	my_offset = my_rank * (spielfeld_dim / nprocs);
-	my_offset += (my_rank > (spielfeld_dim % nprocs)) ? (spielfeld_dim % nprocs) : my_rank;
+/**
+ * Liest Optionen aus einer Konfigurationsdatei: pro Zeile "name wert", Leerzeilen und # = Kommentar werden übersprungen
+ */
+int GOL_konfig_lesen(const char *_datei) {
+	char zeile[512], name[128], wert[384]; // Zeile, Name und Wert
+	FILE *f = fopen(_datei, "r");
 
-	// NUR ROOT: alloziere dynamischen Speicehr für all_offset etc.
-	if (my_rank == ROOT) {
-		all_size = (int*) malloc(nprocs * sizeof(int));
-		all_elements = (int*) malloc(nprocs * sizeof(int));
-		all_offset = (int*) malloc(nprocs * sizeof(int));
+	if (f == NULL) {
+		printf("Error: Konfiguration %s kann nicht gelesen werden\n", _datei);
+		return -1;
 	}
-
-	// Zusammentragen im ROOT-Proc der berechneten Werte für my_size, my_elements und my_offset
-	MPI_Gather(&my_size, 1, MPI_INT, all_size, 1, MPI_INT, ROOT, comm);
-	MPI_Gather(&my_elements, 1, MPI_INT, all_elements, 1, MPI_INT, ROOT, comm);
-	MPI_Gather(&my_offset, 1, MPI_INT, all_offset, 1, MPI_INT, ROOT, comm);
-
-	/** FEHLERSUCHE
-	 if (my_rank == ROOT) {
-	 for (i = 0; i < nprocs; i++)
-	 printf("all_size[%d] = %d // all_elements[%d] = %d // all_offset[%d] = %d\n", i, all_size[i], i, all_elements[i], i, all_offset[i]);
-	 }
-	 */
-
-	// alloziere dynamischen Speicher für Teilspielfelder (jeder Proc für sich)
-	my_spielfeld = malloc2D(my_size + 2, spielfeld_dim + 2);
-	my_zwischen = malloc2D(my_size + 2, spielfeld_dim + 2);
-
-	// NUR ROOT: alloziere dynamischen Speicher für Vollspielfeld
-	if (my_rank == ROOT) {
-		voll = malloc2D(spielfeld_dim, spielfeld_dim + 2);
+	while (fgets(zeile, sizeof(zeile), f) != NULL) {
+		if (sscanf(zeile, " %127s %383s", name, wert) != 2 || name[0] == '#') continue;
+		if (!GOL_option(name[0] == '-' ? name + 1 : name, wert)) printf("Unbekannte Option in %s: %s\n", _datei, name);
 	}
+	fclose(f);
+	return 0;
+}
 
-	/** FEHLERSUCHE
-	 // jeder Proc gibt seinen allozierten Speicher aus
-	 printf("Proc %d / my_spielfeld @ %p (%d Byte) / zwischen @ %p (%d Byte) / voll @ %p (%d Byte)\n", my_rank, my_spielfeld,
-	 (int) ((&my_spielfeld[my_size + 1][matrix_size + 1] - &my_spielfeld[0][0] + 1) * sizeof(int)), my_zwischen,
-	 (int) ((&my_zwischen[my_size + 1][matrix_size + 1] - &my_zwischen[0][0] + 1) * sizeof(int)), voll,
-	 (voll != NULL ? (int) ((&voll[matrix_size + 1][matrix_size + 1] - &voll[0][0] + 1) * sizeof(int)) : 0));
-	 */
-
-	// Initialisierung des Aussenrands mit Nullen, entspricht kein Leben ausserhalb des Spielfelds
-	for (i = 0; i < my_size + 2; i++)
-		my_spielfeld[i][0] = my_spielfeld[i][spielfeld_dim + 1] = my_zwischen[i][0] = my_zwischen[i][spielfeld_dim + 1] = 0;
-	for (j = 0; j < spielfeld_dim + 2; j++)
-		my_spielfeld[0][j] = my_spielfeld[my_size + 1][j] = my_zwischen[0][j] = my_zwischen[my_size + 1][j] = 0;
+/**
+ * Alloziert Speicherplatz für ein bitweises Spielfeld (mit Nullen gefüllt)
+ * _zeilen = Zeilen in Matrix
+ * _worte = Worte pro Zeile (inkl. linkes und rechtes Randwort)
+ */
+uint64_t **malloc2D_bits(int _zeilen, int _worte) {
+	int i; // für Schleife
+	uint64_t *daten = (uint64_t *) calloc((size_t) _zeilen * _worte, sizeof(uint64_t)); // Pointer auf Speicherstelle mit (N x W)-Worten
+	uint64_t **array = (uint64_t **) malloc(_zeilen * sizeof(uint64_t*)); // Pointer auf N-mal Wort Pointer
+	for (i = 0; i < _zeilen; i++)
+		array[i] = &(daten[(size_t) _worte * i]); // Jedem der vorher difiniertem Pointer einen Speicherberich festlegen
+	return array; // Pointer auf die Zeilen zurückgeben
+}
 
-	// für "echte" Zufallszhalen
-	srand(my_rank + time(NULL));
+/**
+ * Gibt ein mit malloc2D_bits alloziertes Spielfeld frei
+ */
+void free2D_bits(uint64_t **_array) {
+	if (_array == NULL) return;
+	free(_array[0]); // zusammenhängende Daten
+	free(_array); // Zeilenpointer
+}
 
-	// Initialisierung des Spielfelds mit Werten, entspricht Anfangsbedingungen
-	for (i = 1; i <= my_size; i++) {
-		for (j = 1; j <= spielfeld_dim; j++)
-			my_spielfeld[i][j] = rand() % 2;
-	}
+/**
+ * Anzahl der Worte für _spalten Zellen (aufgerundet auf ganze Worte)
+ */
+int GOL_worte(int _spalten) {
+	return (_spalten + WORT_BITS - 1) / WORT_BITS;
+}
 
-	MPI_Request request[4]; // für Isend/Irecv; Dimension = Anzahl der Isend/Irecv Operationen
-	MPI_Status status[4]; // für Waitall; Dimension = Anzahl der Isend/Irecv Operationen
+/**
+ * Maske der gültigen Bits im letzten Wort einer Zeile mit _spalten Zellen
+ * die restlichen Bits (Auffüllung bis zum ganzen Wort) bleiben immer 0
+ */
+uint64_t GOL_maske(int _spalten) {
+	int rest = _spalten % WORT_BITS;
+	return rest == 0 ? ~(uint64_t) 0 : ((uint64_t) 1 << rest) - 1;
+}
 
-	// Startzeit speichern (jeder Proc für sich)
+/**
+ * Der Kernel liest vom linken Randwort nur Bit 63 und rechts nur das Bit hinter der letzten Zelle
+ * (Bit 0 des rechten Randwortes bzw. das erste Auffüllbit des letzten Wortes)
+ */
+void GOL_torus_naehen(uint64_t **_feld, int _z_von, int _z_bis, int _nw, int _spalten) {
+	int i; // für Schleife
+	int rest = _spalten - (_nw - 1) * WORT_BITS; // Zellen im letzten Wort
+	for (i = _z_von; i < _z_bis; i++) {
+		_feld[i][0] = (uint64_t) ZELLE(_feld[i], _spalten) << 63;
+		if (rest < WORT_BITS) _feld[i][_nw] |= (uint64_t) (_feld[i][1] & 1) << rest;
+		else _feld[i][_nw + 1] = _feld[i][1] & 1;
+	}
+}
+
+void GOL_torus_trennen(uint64_t **_feld, int _z_von, int _z_bis, int _nw, uint64_t _maske) {
+	int i; // für Schleife
+	for (i = _z_von; i < _z_bis; i++) {
+		_feld[i][0] = 0;
+		_feld[i][_nw] &= _maske;
+		_feld[i][_nw + 1] = 0;
+	}
+}
+
+/**
+ * Bit-Addierwerk für ein Wort (64 Zellen auf einmal)
+ *
+ * Die acht Nachbarn jeder Zelle werden als acht Worte dargestellt (Zeile oben, Mitte, unten
+ * jeweils um eine Zelle nach links und rechts verschoben) und über Volladdierer bitweise summiert.
+ * Ergebnis sind die Bits b0 ... b3 der Nachbarnanzahl (0 ... 8) für alle 64 Zellen.
+ *
+ * Das Makro definiert die Funktion _name für den Typ _typ: uint64_t für den skalaren Kernel,
+ * GCC-Vektortypen (2, 4 oder 8 Worte) für die SIMD-Kernel. Da nur bitweise Operatoren und
+ * Verschiebungen innerhalb eines Wortes vorkommen, rechnen alle Varianten bitgleich.
+ *
+ * Die Regel (_geburt, _ueberleben: Bit n = bei n Nachbarn) wird als Summe der Terme "Anzahl == n" ausgewertet;
+ * sind die Masken Konstanten, bleiben davon nur die Terme der Regel übrig (für B3/S23 die kurze Form von Hand).
+ * Mit Variablen als Masken rechnet derselbe Code jede Regel zur Laufzeit.
+ *
+ * Parameter:
+ *  _o_l, _o, _o_r: Vorgänger-, eigenes und Nachfolgewort der Zeile oben
+ *  _m_l, _m, _m_r: Vorgänger-, eigenes und Nachfolgewort der Zeile selbst
+ *  _u_l, _u, _u_r: Vorgänger-, eigenes und Nachfolgewort der Zeile unten
+ */
+#define GOL_REGEL_BIT(_maske, _n) ((uint64_t) 0 - (uint64_t) (((_maske) >> (_n)) & 1)) // Bit _n der Regel als Wort
+#define GOL_REGEL_TERM(_n, _geburt, _ueberleben) \
+	((((_n) & 1) ? b0 : ~b0) & (((_n) & 2) ? b1 : ~b1) & (((_n) & 4) ? b2 : ~b2) & (((_n) & 8) ? b3 : ~b3) \
+			& ((GOL_REGEL_BIT(_geburt, _n) & ~_m) | (GOL_REGEL_BIT(_ueberleben, _n) & _m)))
+#define GOL_WORT_DEFINIEREN(_name, _typ, _attribut, _geburt, _ueberleben) \
+static inline _attribut _typ _name(_typ _o_l, _typ _o, _typ _o_r, _typ _m_l, _typ _m, _typ _m_r, _typ _u_l, _typ _u, _typ _u_r) { \
+	/* Nachbarn links (Bit j - 1) und rechts (Bit j + 1) an die Position j schieben */ \
+	_typ ol = (_o << 1) | (_o_l >> 63), or = (_o >> 1) | (_o_r << 63); \
+	_typ ml = (_m << 1) | (_m_l >> 63), mr = (_m >> 1) | (_m_r << 63); \
+	_typ ul = (_u << 1) | (_u_l >> 63), ur = (_u >> 1) | (_u_r << 63); \
+	_typ s_o, c_o, s_m, c_m, s_u, c_u, s, c, b0, b1, b2, b3, k1, k2; \
+	/* Zeilensummen: oben und unten je 3 Zellen (Volladdierer), Mitte 2 Zellen (Halbaddierer) */ \
+	s_o = ol ^ _o ^ or; \
+	c_o = (ol & _o) | (or & (ol ^ _o)); \
+	s_m = ml ^ mr; \
+	c_m = ml & mr; \
+	s_u = ul ^ _u ^ ur; \
+	c_u = (ul & _u) | (ur & (ul ^ _u)); \
+	/* Einer-Stelle der Gesamtsumme und Übertrag k1 in die Zweier-Stelle */ \
+	b0 = s_o ^ s_m ^ s_u; \
+	k1 = (s_o & s_m) | (s_u & (s_o ^ s_m)); \
+	/* Zweier-Stelle: c_o + c_m + c_u + k1 (Werte 0 ... 4) */ \
+	s = c_o ^ c_m ^ c_u; \
+	c = (c_o & c_m) | (c_u & (c_o ^ c_m)); \
+	b1 = s ^ k1; \
+	k2 = s & k1; \
+	b2 = c ^ k2; \
+	b3 = c & k2; \
+	/* leben, sterben, neues Leben ? -> B3/S23: genau 3 Nachbarn oder lebend mit genau 2 Nachbarn */ \
+	if ((_geburt) == 0x008 && (_ueberleben) == 0x00C) return b1 & ~b2 & ~b3 & (b0 | _m); \
+	return GOL_REGEL_TERM(0, _geburt, _ueberleben) | GOL_REGEL_TERM(1, _geburt, _ueberleben) | GOL_REGEL_TERM(2, _geburt, _ueberleben) \
+			| GOL_REGEL_TERM(3, _geburt, _ueberleben) | GOL_REGEL_TERM(4, _geburt, _ueberleben) | GOL_REGEL_TERM(5, _geburt, _ueberleben) \
+			| GOL_REGEL_TERM(6, _geburt, _ueberleben) | GOL_REGEL_TERM(7, _geburt, _ueberleben) | GOL_REGEL_TERM(8, _geburt, _ueberleben); \
+}
+
+/**
+ * skalarer Kernel: berechnet die Worte [_von, _bis) der nächsten Generation einer Zeile
+ * die Worte _von - 1 und _bis müssen lesbar sein (Randworte bzw. Nachbarworte)
+ */
+#define GOL_SKALAR_DEFINIEREN(_name, _geburt, _ueberleben) \
+GOL_WORT_DEFINIEREN(_name##_wort, uint64_t, , _geburt, _ueberleben) \
+void _name##_skalar(const uint64_t *_oben, const uint64_t *_mitte, const uint64_t *_unten, uint64_t *_ziel, int _von, int _bis) { \
+	int w; /* für Schleife */ \
+	for (w = _von; w < _bis; w++) { \
+		_ziel[w] = _name##_wort(_oben[w - 1], _oben[w], _oben[w + 1], _mitte[w - 1], _mitte[w], _mitte[w + 1], _unten[w - 1], _unten[w], \
+				_unten[w + 1]); \
+	} \
+}
+
+#if GOL_SIMD
+/**
+ * SIMD-Kernel: wie der skalare Kernel der Regel _regel, aber _breite Worte pro Schritt in einem Vektorregister
+ * Die Nachbarworte werden einfach um ein Wort versetzt (unausgerichtet) geladen,
+ * der Rest der Zeile (weniger als _breite Worte) wird skalar berechnet.
+ */
+#define GOL_ZEILE_DEFINIEREN(_name, _typ, _breite, _ziel_isa, _regel, _geburt, _ueberleben) \
+GOL_WORT_DEFINIEREN(_name##_wort, _typ, __attribute__((always_inline, target(_ziel_isa))), _geburt, _ueberleben) \
+__attribute__((target(_ziel_isa))) \
+void _name(const uint64_t *_oben, const uint64_t *_mitte, const uint64_t *_unten, uint64_t *_ziel, int _von, int _bis) { \
+	int w; /* für Schleife */ \
+	_typ o_l, o, o_r, m_l, m, m_r, u_l, u, u_r, z; \
+	for (w = _von; w + (_breite) <= _bis; w += (_breite)) { \
+		memcpy(&o_l, _oben + w - 1, sizeof(_typ)); memcpy(&o, _oben + w, sizeof(_typ)); memcpy(&o_r, _oben + w + 1, sizeof(_typ)); \
+		memcpy(&m_l, _mitte + w - 1, sizeof(_typ)); memcpy(&m, _mitte + w, sizeof(_typ)); memcpy(&m_r, _mitte + w + 1, sizeof(_typ)); \
+		memcpy(&u_l, _unten + w - 1, sizeof(_typ)); memcpy(&u, _unten + w, sizeof(_typ)); memcpy(&u_r, _unten + w + 1, sizeof(_typ)); \
+		z = _name##_wort(o_l, o, o_r, m_l, m, m_r, u_l, u, u_r); \
+		memcpy(_ziel + w, &z, sizeof(_typ)); \
+	} \
+	_regel##_skalar(_oben, _mitte, _unten, _ziel, w, _bis); \
+}
+
+typedef uint64_t GOL_v2 __attribute__((vector_size(16))); // 128 Bit: SSE2
+typedef uint64_t GOL_v4 __attribute__((vector_size(32))); // 256 Bit: AVX2
+typedef uint64_t GOL_v8 __attribute__((vector_size(64))); // 512 Bit: AVX-512
+#endif
+
+/**
+ * Kernel einer Regel für alle Befehlssätze: _name_skalar, _name_sse2, _name_avx2, _name_avx512
+ * (und die skalare Wortfunktion _name_wort für Randworte und Hashlife)
+ */
+#if GOL_SIMD
+#define GOL_REGEL_DEFINIEREN(_name, _geburt, _ueberleben) \
+GOL_SKALAR_DEFINIEREN(_name, _geburt, _ueberleben) \
+GOL_ZEILE_DEFINIEREN(_name##_sse2, GOL_v2, 2, "sse2", _name, _geburt, _ueberleben) \
+GOL_ZEILE_DEFINIEREN(_name##_avx2, GOL_v4, 4, "avx2", _name, _geburt, _ueberleben) \
+GOL_ZEILE_DEFINIEREN(_name##_avx512, GOL_v8, 8, "avx512f", _name, _geburt, _ueberleben)
+#else
+#define GOL_REGEL_DEFINIEREN(_name, _geburt, _ueberleben) GOL_SKALAR_DEFINIEREN(_name, _geburt, _ueberleben)
+#endif
+
+/**
+ * Regeln mit eigenen Kernels (Masken als Konstanten) und der allgemeine Kernel für jede andere Regel
+ * (Masken aus GOL_regel, zur Laufzeit); Reihenfolge wie in GOL_regel_liste
+ */
+GOL_REGEL_DEFINIEREN(GOL_conway, 0x008, 0x00C)
+GOL_REGEL_DEFINIEREN(GOL_highlife, 0x048, 0x00C)
+GOL_REGEL_DEFINIEREN(GOL_seeds, 0x004, 0x000)
+GOL_REGEL_DEFINIEREN(GOL_daynight, 0x1C8, 0x1D8)
+GOL_REGEL_DEFINIEREN(GOL_ohnetod, 0x008, 0x1FF)
+GOL_REGEL_DEFINIEREN(GOL_allgemein, GOL_regel.geburt, GOL_regel.ueberleben)
+
+GOL_regel_eintrag GOL_regel_liste[GOL_REGELN] = {
+		{ "Conway", 0x008, 0x00C, GOL_conway_wort },
+		{ "HighLife", 0x048, 0x00C, GOL_highlife_wort },
+		{ "Seeds", 0x004, 0x000, GOL_seeds_wort },
+		{ "Day & Night", 0x1C8, 0x1D8, GOL_daynight_wort },
+		{ "Life without Death", 0x008, 0x1FF, GOL_ohnetod_wort },
+		{ NULL, 0, 0, GOL_allgemein_wort } };
+
+/**
+ * Tabelle der Kernel, der erste vom Prozessor unterstützte Eintrag wird verwendet
+ * (isa == NULL -> läuft überall); je Befehlssatz ein Kernel pro Regel
+ */
+#define GOL_KERNEL_EINTRAG(_name, _isa, _suffix) \
+		{ _name, _isa, { GOL_conway_##_suffix, GOL_highlife_##_suffix, GOL_seeds_##_suffix, GOL_daynight_##_suffix, GOL_ohnetod_##_suffix, \
+				GOL_allgemein_##_suffix } }
+GOL_kernel GOL_kernel_liste[] = {
+#if GOL_SIMD
+		GOL_KERNEL_EINTRAG("avx512", "avx512f", avx512),
+		GOL_KERNEL_EINTRAG("avx2", "avx2", avx2),
+		GOL_KERNEL_EINTRAG("sse2", "sse2", sse2),
+#endif
+		GOL_KERNEL_EINTRAG("skalar", NULL, skalar),
+		{ NULL, NULL, { NULL } } };
+
+// aktiver Kernel und aktive Regel, werden von GOL_kernel_waehlen() bzw. GOL_regel_waehlen() gesetzt
+void (*GOL_zeile)(const uint64_t *, const uint64_t *, const uint64_t *, uint64_t *, int, int) = GOL_conway_skalar;
+uint64_t (*GOL_wort)(uint64_t, uint64_t, uint64_t, uint64_t, uint64_t, uint64_t, uint64_t, uint64_t, uint64_t) = GOL_conway_wort;
+const char *GOL_kernel_name = "skalar";
+int GOL_kernel_nr = 0; // Eintrag in GOL_kernel_liste
+int GOL_regel_nr = 0; // Eintrag in GOL_regel_liste
+
+/**
+ * Prüft, ob der Prozessor den Befehlssatz eines Kernels unterstützt (CPUID)
+ */
+int GOL_kernel_verfuegbar(const GOL_kernel *_kernel) {
+	if (_kernel->isa == NULL) return 1;
+#if GOL_SIMD
+	__builtin_cpu_init();
+	if (strcmp(_kernel->isa, "avx512f") == 0) return __builtin_cpu_supports("avx512f");
+	if (strcmp(_kernel->isa, "avx2") == 0) return __builtin_cpu_supports("avx2");
+	if (strcmp(_kernel->isa, "sse2") == 0) return __builtin_cpu_supports("sse2");
+#endif
+	return 0;
+}
+
+/**
+ * Wählt zur Laufzeit den schnellsten vom Prozessor unterstützten Kernel
+ */
+void GOL_kernel_waehlen(void) {
+	int i; // für Schleife
+	for (i = 0; GOL_kernel_liste[i].name != NULL; i++) {
+		if (GOL_kernel_verfuegbar(&GOL_kernel_liste[i])) {
+			GOL_kernel_nr = i;
+			GOL_zeile = GOL_kernel_liste[i].zeile[GOL_regel_nr];
+			GOL_kernel_name = GOL_kernel_liste[i].name;
+			return;
+		}
+	}
+}
+
+/**
+ * Liest eine Regel in B/S-Schreibweise ("B3/S23", auch "S23/B3", Groß- oder Kleinbuchstaben)
+ * oder in der alten Schreibweise Überleben/Geburt ohne Buchstaben ("23/3")
+ */
+int GOL_regel_lesen(const char *_text, int *_geburt, int *_ueberleben) {
+	int buchstaben = (strpbrk(_text, "BbSs") != NULL); // B/S-Schreibweise?
+	int *ziel = buchstaben ? NULL : _ueberleben; // Maske, in die die folgenden Ziffern gehen
+	const char *p; // für Schleife
+
+	*_geburt = *_ueberleben = 0;
+	for (p = _text; *p != '\0'; p++) {
+		if (buchstaben && (*p == 'B' || *p == 'b')) ziel = _geburt;
+		else if (buchstaben && (*p == 'S' || *p == 's')) ziel = _ueberleben;
+		else if (*p == '/' && buchstaben) continue;
+		else if (*p == '/' && ziel == _ueberleben) ziel = _geburt; // alte Schreibweise: nach dem Schrägstrich die Geburt
+		else if (*p >= '0' && *p <= '8' && ziel != NULL) *ziel |= 1 << (*p - '0');
+		else return -1;
+	}
+	return (buchstaben || ziel == _geburt) ? 0 : -1;
+}
+
+/**
+ * Setzt die Regel aus optionen.regel (leer = B3/S23): eigener Kernel, falls die Regel in GOL_regel_liste steht,
+ * sonst der allgemeine Kernel mit den Masken in GOL_regel; liefert -1 bei einer ungültigen Regel (dann B3/S23)
+ */
+int GOL_regel_waehlen(void) {
+	int geburt = 0x008, ueberleben = 0x00C; // Masken der Regel
+	int fehler = 0; // ungültige Regel?
+
+	if (optionen.regel[0] != '\0' && GOL_regel_lesen(optionen.regel, &geburt, &ueberleben) != 0) {
+		geburt = 0x008;
+		ueberleben = 0x00C;
+		fehler = -1;
+	}
+	GOL_regel.geburt = geburt;
+	GOL_regel.ueberleben = ueberleben;
+	for (GOL_regel_nr = 0; GOL_regel_nr < GOL_REGELN - 1; GOL_regel_nr++) {
+		if (GOL_regel_liste[GOL_regel_nr].geburt == geburt && GOL_regel_liste[GOL_regel_nr].ueberleben == ueberleben) break;
+	}
+	GOL_zeile = GOL_kernel_liste[GOL_kernel_nr].zeile[GOL_regel_nr];
+	GOL_wort = GOL_regel_liste[GOL_regel_nr].wort;
+	return fehler;
+}
+
+/**
+ * Schreibt die Regel in B/S-Schreibweise nach _text
+ */
+void GOL_regel_text(char *_text, int _geburt, int _ueberleben) {
+	int n; // für Schleife
+	*_text++ = 'B';
+	for (n = 0; n <= 8; n++)
+		if (_geburt & (1 << n)) *_text++ = (char) ('0' + n);
+	*_text++ = '/';
+	*_text++ = 'S';
+	for (n = 0; n <= 8; n++)
+		if (_ueberleben & (1 << n)) *_text++ = (char) ('0' + n);
+	*_text = '\0';
+}
+
+/**
+ * Berechnet einen Block von Zeilen und Worten der nächsten Generation
+ * _alt: Spielfeld der aktuellen Generation (die Nachbarzeilen des Blocks müssen lesbar sein)
+ * _neu: Spielfeld der nächsten Generation
+ * _worte: Worte pro Zeile; die Randworte 0 und _worte - 1 dürfen mitberechnet werden (tiefe Überlappung),
+ *         ihr äusserer Nachbar gilt dabei als tot
+ * _maske: gültige Bits des letzten eigenen Wortes (_worte - 2), Auffüllbits bleiben tot
+ * _maske_rand: gültige Bits des rechten Randwortes, falls es mitberechnet wird
+ *              (ist es das angebrochene letzte Wort des Spielfelds, dürfen seine Auffüllbits nicht aufleben)
+ */
+void GOL_block(uint64_t **_alt, uint64_t **_neu, int _z_von, int _z_bis, int _w_von, int _w_bis, int _worte, uint64_t _maske,
+		uint64_t _maske_rand) {
+	int i; // für Schleife
+	int von = (_w_von == 0) ? 1 : _w_von; // Randworte werden gesondert berechnet
+	int bis = (_w_bis == _worte) ? _worte - 1 : _w_bis;
+	const uint64_t *o, *m, *u; // Zeilen oben, Mitte, unten
+	if (_w_von >= _w_bis) return;
+	for (i = _z_von; i < _z_bis; i++) {
+		o = _alt[i - 1];
+		m = _alt[i];
+		u = _alt[i + 1];
+		if (_w_von == 0) _neu[i][0] = GOL_wort(0, o[0], o[1], 0, m[0], m[1], 0, u[0], u[1]);
+		if (von < bis) GOL_zeile(o, m, u, _neu[i], von, bis);
+		if (_w_bis == _worte)
+			_neu[i][_worte - 1] = _maske_rand
+					& GOL_wort(o[_worte - 2], o[_worte - 1], 0, m[_worte - 2], m[_worte - 1], 0, u[_worte - 2], u[_worte - 1], 0);
+		if (_worte - 2 >= _w_von && _worte - 2 < _w_bis) _neu[i][_worte - 2] &= _maske;
+	}
+}
+
+/**
+ * Streut einen 64-Bit-Wert über alle Bits (Finalisierer von splitmix64)
+ */
+static inline uint64_t GOL_mischen(uint64_t _x) {
+	_x ^= _x >> 30;
+	_x *= 0xbf58476d1ce4e5b9ULL;
+	_x ^= _x >> 27;
+	_x *= 0x94d049bb133111ebULL;
+	return _x ^ (_x >> 31);
+}
+
+/**
+ * Beitrag eines Wortes zum Fingerabdruck: Inhalt gemischt mit der Lage im Spielfeld (Zeile, Wort ab 0);
+ * leere Worte zählen nicht, ein frisch angelegtes Spielfeld hat also den Fingerabdruck 0
+ */
+static inline uint64_t GOL_wort_hash(uint64_t _w, int _zeile, int _wort) {
+	return GOL_mischen(_w ^ ((uint64_t) _zeile * 0x9e3779b97f4a7c15ULL + (uint64_t) _wort * 0xc2b2ae3d27d4eb4fULL)) & ((uint64_t) 0 - (_w != 0));
+}
+
+/**
+ * Kacheln über dem eigenen Bereich anlegen, zu Beginn gelten alle als geändert
+ * _zeile0, _wort0: Lage der ersten eigenen Zeile bzw. des ersten eigenen Wortes im Spielfeld (für die Fingerabdrücke)
+ */
+void GOL_kacheln_anlegen(GOL_kacheln *_k, int _z0, int _zeilen, int _worte, int _zeile0, int _wort0) {
+	_k->z0 = _z0;
+	_k->zeilen = _zeilen;
+	_k->worte = _worte;
+	_k->kz = (_zeilen + KACHEL_ZEILEN - 1) / KACHEL_ZEILEN;
+	_k->kw = (_worte + KACHEL_WORTE - 1) / KACHEL_WORTE;
+	_k->geaendert = (unsigned char *) malloc((size_t) _k->kz * _k->kw);
+	_k->rechnen = (unsigned char *) malloc((size_t) _k->kz * _k->kw);
+	memset(_k->geaendert, 1, (size_t) _k->kz * _k->kw);
+	memset(_k->rechnen, 1, (size_t) _k->kz * _k->kw);
+	_k->erste = 1;
+	_k->gerechnet = 0;
+	_k->gesamt = 0;
+	_k->zeile0 = _zeile0;
+	_k->wort0 = _wort0;
+	_k->hash = _k->hash_vorher = 0;
+}
+
+void GOL_kacheln_freigeben(GOL_kacheln *_k) {
+	free(_k->geaendert);
+	free(_k->rechnen);
+}
+
+/**
+ * Kachel berechnen, wenn sie selbst oder eine ihrer acht Nachbarkacheln sich in der letzten Runde geändert hat;
+ * danach werden die Änderungen der neuen Runde gesammelt
+ */
+void GOL_kacheln_planen(GOL_kacheln *_k) {
+	int a, b, da, db; // für Schleifen
+	int r; // Kachel rechnen?
+	uint64_t hash = _k->hash_vorher; // Fingerabdruck der vorletzten Generation, die jetzt überschrieben wird
+
+	// Fingerabdruck: im Zielspielfeld steht die vorletzte Generation, GOL_kacheln_block führt ihn um die geänderten
+	// Worte nach; ohne Kacheln wird jede Zeile neu gezählt
+	_k->hash_vorher = _k->hash;
+	_k->hash = optionen.kacheln ? hash : 0;
+	for (a = 0; a < _k->kz; a++) {
+		for (b = 0; b < _k->kw; b++) {
+			r = 0;
+			for (da = (a > 0 ? -1 : 0); da <= (a < _k->kz - 1 ? 1 : 0) && !r; da++) {
+				for (db = (b > 0 ? -1 : 0); db <= (b < _k->kw - 1 ? 1 : 0); db++)
+					r |= _k->geaendert[(a + da) * _k->kw + b + db];
+			}
+			_k->rechnen[a * _k->kw + b] = r;
+			_k->gerechnet += r;
+		}
+	}
+	_k->gesamt += (long long) _k->kz * _k->kw;
+	// in der ersten Runde wird mit einem leeren Zielspielfeld verglichen, dort bleibt alles geändert
+	if (_k->erste) _k->erste = 0;
+	else memset(_k->geaendert, 0, (size_t) _k->kz * _k->kw);
+}
+
+/**
+ * Liegt Kachel (_a, _b) an der Seite bzw. Ecke _richtung des eigenen Bereichs?
+ */
+static int GOL_kachel_an_seite(const GOL_kacheln *_k, int _richtung, int _a, int _b) {
+	int oben = (_richtung == OBEN || _richtung == OBEN_LINKS || _richtung == OBEN_RECHTS);
+	int unten = (_richtung == UNTEN || _richtung == UNTEN_LINKS || _richtung == UNTEN_RECHTS);
+	int links = (_richtung == LINKS || _richtung == OBEN_LINKS || _richtung == UNTEN_LINKS);
+	int rechts = (_richtung == RECHTS || _richtung == OBEN_RECHTS || _richtung == UNTEN_RECHTS);
+	if ((oben || unten) && !(oben && _a == 0) && !(unten && _a == _k->kz - 1)) return 0;
+	if ((links || rechts) && !(links && _b == 0) && !(rechts && _b == _k->kw - 1)) return 0;
+	return 1;
+}
+
+/**
+ * Kacheln an der Seite bzw. Ecke _richtung zusätzlich rechnen
+ */
+void GOL_kacheln_rand(GOL_kacheln *_k, int _richtung) {
+	int a, b; // für Schleifen
+	for (a = 0; a < _k->kz; a++) {
+		for (b = 0; b < _k->kw; b++) {
+			if (!GOL_kachel_an_seite(_k, _richtung, a, b)) continue;
+			if (!_k->rechnen[a * _k->kw + b]) _k->gerechnet++;
+			_k->rechnen[a * _k->kw + b] = 1;
+		}
+	}
+}
+
+/**
+ * Hat sich eine Kachel an der Seite bzw. Ecke _richtung in der letzten Runde geändert?
+ * (wenn nicht, ist der Rand in dieser Richtung gleich dem von vor zwei Runden)
+ */
+int GOL_kacheln_seite_geaendert(const GOL_kacheln *_k, int _richtung) {
+	int a, b; // für Schleifen
+	for (a = 0; a < _k->kz; a++) {
+		for (b = 0; b < _k->kw; b++)
+			if (GOL_kachel_an_seite(_k, _richtung, a, b) && _k->geaendert[a * _k->kw + b]) return 1;
+	}
+	return 0;
+}
+
+/**
+ * Berechnet den Block Zeilen [_z_von, _z_bis) x Worte [_w_von, _w_bis) wie GOL_block, im eigenen Bereich
+ * aber nur die Teile der geplanten Kacheln; ob sich eine Kachel geändert hat, wird zeilenweise durch
+ * Vergleich mit dem überschriebenen Inhalt (der vorletzten Generation) festgestellt
+ */
+void GOL_kacheln_block(GOL_kacheln *_k, uint64_t **_alt, uint64_t **_neu, int _z_von, int _z_bis, int _w_von, int _w_bis, int _worte,
+		uint64_t _maske, uint64_t _maske_rand) {
+	int t, a, b, i, w; // für Schleifen
+	int z_von, z_bis, w_von, w_bis; // Teil des Blocks im eigenen Bereich
+	int kz_von, kz_bis, kw_von, kw_bis, kn; // betroffene Kacheln (kn = Anzahl)
+	int zv, zb, wv, wb; // Teil einer Kachel
+	int eigen_bis = _k->z0 + _k->zeilen; // erste Zeile nach dem eigenen Bereich
+	uint64_t vorher[KACHEL_WORTE]; // überschriebene Zeile der Kachel
+	unsigned char *geaendert;
+	uint64_t hash = 0; // Änderung des Fingerabdrucks
+	int zyklus = optionen.zyklus > 0; // Fingerabdruck nachführen?
+
+	if (_z_von >= _z_bis || _w_von >= _w_bis) return;
+	if (!optionen.kacheln) {
+		// ohne Kacheln: Streifen von KACHEL_ZEILEN Zeilen auf die Threads verteilen, der Fingerabdruck zählt die eigenen
+		// Zellen jedes Streifens gleich nach dem Rechnen (noch im Cache)
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) if (_z_bis - _z_von > KACHEL_ZEILEN) reduction(+:hash)
+#endif
+		for (i = _z_von; i < _z_bis; i += KACHEL_ZEILEN) {
+			GOL_block(_alt, _neu, i, (i + KACHEL_ZEILEN < _z_bis) ? i + KACHEL_ZEILEN : _z_bis, _w_von, _w_bis, _worte, _maske, _maske_rand);
+			if (zyklus) hash += GOL_kacheln_hash(_k, _neu, i, (i + KACHEL_ZEILEN < _z_bis) ? i + KACHEL_ZEILEN : _z_bis, _w_von, _w_bis);
+		}
+		_k->hash += hash;
+		return;
+	}
+
+	// Randzeilen und Randworte (tiefe Überlappung) liegen ausserhalb der Kacheln und werden immer gerechnet
+	if (_z_von < _k->z0) GOL_block(_alt, _neu, _z_von, (_z_bis < _k->z0) ? _z_bis : _k->z0, _w_von, _w_bis, _worte, _maske, _maske_rand);
+	if (_z_bis > eigen_bis)
+		GOL_block(_alt, _neu, (_z_von > eigen_bis) ? _z_von : eigen_bis, _z_bis, _w_von, _w_bis, _worte, _maske, _maske_rand);
+	z_von = (_z_von > _k->z0) ? _z_von : _k->z0;
+	z_bis = (_z_bis < eigen_bis) ? _z_bis : eigen_bis;
+	if (z_von >= z_bis) return;
+	if (_w_von == 0) GOL_block(_alt, _neu, z_von, z_bis, 0, 1, _worte, _maske, _maske_rand);
+	if (_w_bis == _worte) GOL_block(_alt, _neu, z_von, z_bis, _worte - 1, _worte, _worte, _maske, _maske_rand);
+	w_von = (_w_von > 1) ? _w_von : 1;
+	w_bis = (_w_bis < _worte - 1) ? _w_bis : _worte - 1;
+	if (w_von >= w_bis) return;
+
+	kz_von = (z_von - _k->z0) / KACHEL_ZEILEN;
+	kz_bis = (z_bis - 1 - _k->z0) / KACHEL_ZEILEN;
+	kw_von = (w_von - 1) / KACHEL_WORTE;
+	kw_bis = (w_bis - 2) / KACHEL_WORTE;
+	kn = (kz_bis - kz_von + 1) * (kw_bis - kw_von + 1);
+
+	// die Kacheln sind unabhängig (jede schreibt nur ihre eigenen Zeilen, Worte und ihr Flag) -> auf die Threads verteilen;
+	// dynamisch, da ruhige Kacheln fast nichts kosten
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) if (kn > 1) private(a, b, i, w, zv, zb, wv, wb, vorher, geaendert) reduction(+:hash)
+#endif
+	for (t = 0; t < kn; t++) {
+		a = kz_von + t / (kw_bis - kw_von + 1);
+		b = kw_von + t % (kw_bis - kw_von + 1);
+		if (!_k->rechnen[a * _k->kw + b]) continue;
+		zv = _k->z0 + a * KACHEL_ZEILEN;
+		zb = zv + KACHEL_ZEILEN;
+		if (zv < z_von) zv = z_von;
+		if (zb > z_bis) zb = z_bis;
+		wv = 1 + b * KACHEL_WORTE;
+		wb = wv + KACHEL_WORTE;
+		if (wv < w_von) wv = w_von;
+		if (wb > w_bis) wb = w_bis;
+		geaendert = &_k->geaendert[a * _k->kw + b];
+		for (i = zv; i < zb; i++) {
+			if (*geaendert && !zyklus) {
+				GOL_block(_alt, _neu, i, zb, wv, wb, _worte, _maske, _maske_rand); // Rest der Kachel ohne Vergleich
+				break;
+			}
+			memcpy(vorher, &_neu[i][wv], (wb - wv) * sizeof(uint64_t));
+			GOL_block(_alt, _neu, i, i + 1, wv, wb, _worte, _maske, _maske_rand);
+			for (w = wv; w < wb; w++) {
+				if (_neu[i][w] == vorher[w - wv]) continue;
+				*geaendert = 1;
+				if (zyklus)
+					hash += GOL_wort_hash(_neu[i][w], _k->zeile0 + i - _k->z0, _k->wort0 + w - 1)
+							- GOL_wort_hash(vorher[w - wv], _k->zeile0 + i - _k->z0, _k->wort0 + w - 1);
+			}
+		}
+	}
+	_k->hash += hash;
+}
+
+/**
+ * Fingerabdruck eines Teils des eigenen Bereichs (Randzeilen und Randworte zählen nicht)
+ */
+uint64_t GOL_kacheln_hash(const GOL_kacheln *_k, uint64_t **_feld, int _z_von, int _z_bis, int _w_von, int _w_bis) {
+	int i, w; // für Schleifen
+	uint64_t hash = 0;
+	if (_z_von < _k->z0) _z_von = _k->z0;
+	if (_z_bis > _k->z0 + _k->zeilen) _z_bis = _k->z0 + _k->zeilen;
+	if (_w_von < 1) _w_von = 1;
+	if (_w_bis > _k->worte + 1) _w_bis = _k->worte + 1;
+	for (i = _z_von; i < _z_bis; i++) {
+		for (w = _w_von; w < _w_bis; w++)
+			hash += GOL_wort_hash(_feld[i][w], _k->zeile0 + i - _k->z0, _k->wort0 + w - 1);
+	}
+	return hash;
+}
+
+/**
+ * Zykluserkennung anlegen: höchstens optionen.zyklus alte Fingerabdrücke und ein Block neuer
+ */
+void GOL_zyklus_anlegen(GOL_zyklus *_z) {
+	_z->block = (optionen.zyklus > GOL_ZYKLUS_BLOCK) ? optionen.zyklus : GOL_ZYKLUS_BLOCK;
+	_z->lokal = (uint64_t *) malloc(_z->block * sizeof(uint64_t));
+	_z->verlauf = (uint64_t *) malloc((optionen.zyklus + _z->block) * sizeof(uint64_t));
+	_z->n_lokal = _z->n_verlauf = 0;
+	_z->runde = 0;
+	_z->periode = 0;
+}
+
+int GOL_zyklus_merken(GOL_zyklus *_z, MPI_Comm _comm, int _runde, uint64_t _hash, int _letzte) {
+	int my_rank; // eigene Prozess-ID
+	int j, p, alt; // für Schleifen, alte Einträge im Verlauf
+	int ab = 0; // erste Runde des Zyklus
+	if (optionen.zyklus <= 0 || _z->periode > 0) return 0;
+	if (_z->n_verlauf == 0 && _z->n_lokal == 0) _z->runde = _runde;
+	_z->lokal[_z->n_lokal++] = _hash;
+	if (_z->n_lokal < _z->block && !_letzte) return 0;
+
+	// Fingerabdrücke des ganzen Spielfelds: Summe der eigenen Bereiche (bei allen Procs gleich, alle entscheiden gleich)
+	MPI_Allreduce(_z->lokal, &_z->verlauf[_z->n_verlauf], _z->n_lokal, MPI_UINT64_T, MPI_SUM, _comm);
+	alt = _z->n_verlauf;
+	_z->n_verlauf += _z->n_lokal;
+	_z->n_lokal = 0;
+
+	// kleinste Periode der ersten wiederholten Generation
+	for (j = alt; j < _z->n_verlauf && _z->periode == 0; j++) {
+		for (p = 1; p <= optionen.zyklus && p <= j; p++) {
+			if (_z->verlauf[j] == _z->verlauf[j - p]) {
+				_z->periode = p;
+				ab = _z->runde + j - p;
+				break;
+			}
+		}
+	}
+	if (_z->periode > 0) {
+		MPI_Comm_rank(_comm, &my_rank);
+		if (my_rank == ROOT && optionen.ausgabe) {
+			if (_z->periode == 1) printf("Zyklus: ab Runde %d unverändert (erkannt nach Runde %d)%s\n", ab, _runde,
+					optionen.zyklus_ende ? ", Spiel beendet" : "");
+			else printf("Zyklus: ab Runde %d mit Periode %d (erkannt nach Runde %d)%s\n", ab, _z->periode, _runde,
+					optionen.zyklus_ende ? ", Spiel beendet" : "");
+		}
+		return 1;
+	}
+
+	// nur die letzten optionen.zyklus Fingerabdrücke werden noch gebraucht
+	alt = (_z->n_verlauf > optionen.zyklus) ? _z->n_verlauf - optionen.zyklus : 0;
+	memmove(_z->verlauf, &_z->verlauf[alt], (_z->n_verlauf - alt) * sizeof(uint64_t));
+	_z->n_verlauf -= alt;
+	_z->runde += alt;
+	return 0;
+}
+
+void GOL_zyklus_freigeben(GOL_zyklus *_z) {
+	free(_z->lokal);
+	free(_z->verlauf);
+}
+
+/**
+ * Legt die Anzahl der Threads pro Proc fest
+ * ohne Angabe: Kerne des Knotens geteilt durch die Procs auf diesem Knoten (MPI_Comm_split_type, ab MPI-3),
+ * mit -np = Kerne also wie bisher ein Thread pro Proc. Ohne OpenMP oder ohne MPI_THREAD_FUNNELED bleibt es bei einem Thread.
+ */
+int GOL_threads_einrichten(MPI_Comm _comm, int _thread_level) {
+#ifdef _OPENMP
+	int threads = optionen.threads; // Threads pro Proc
+	int procs_knoten = 1; // Procs auf dem eigenen Knoten
+	int kerne = omp_get_num_procs(); // Kerne des Knotens
+#if MPI_VERSION >= 3
+	MPI_Comm knoten; // Procs mit gemeinsamem Speicher
+
+	MPI_Comm_split_type(_comm, MPI_COMM_TYPE_SHARED, 0, MPI_INFO_NULL, &knoten);
+	MPI_Comm_size(knoten, &procs_knoten);
+	MPI_Comm_free(&knoten);
+#endif
+	if (threads < 1) threads = (kerne > procs_knoten) ? kerne / procs_knoten : 1;
+	if (_thread_level < MPI_THREAD_FUNNELED) {
+		printf("MPI unterstützt keine Threads (MPI_THREAD_FUNNELED), rechne mit einem Thread\n");
+		threads = 1;
+	}
+	omp_set_num_threads(threads);
+	return threads;
+#else
+	return 1; // ohne OpenMP übersetzt
+#endif
+}
+
+/**
+ * Bestimmt den Nachbarn in einer Richtung im Prozessgitter
+ * (MPI_Cart_shift kennt nur die vier geraden Richtungen, die Ecken brauchen aber auch die diagonalen Nachbarn)
+ */
+int GOL_nachbar(MPI_Comm _cart, const int *_dims, const int *_periods, const int *_coords, int _richtung) {
+	static const int dy[8] = { -1, 1, 0, 0, -1, 1, -1, 1 }; // Zeilenversatz je Richtung
+	static const int dx[8] = { 0, 0, -1, 1, -1, 1, 1, -1 }; // Spaltenversatz je Richtung
+	int c[2], n, nachbar; // Koordinaten und Rang des Nachbarn
+
+	c[0] = _coords[0] + dy[_richtung];
+	c[1] = _coords[1] + dx[_richtung];
+	for (n = 0; n < 2; n++) {
+		if (c[n] < 0 || c[n] >= _dims[n]) {
+			if (!_periods[n]) return MPI_PROC_NULL; // ausserhalb des Spielfelds
+			c[n] = (c[n] + _dims[n]) % _dims[n];
+		}
+	}
+	MPI_Cart_rank(_cart, c, &nachbar);
+	return nachbar;
+}
+
+/**
+ * Lage der Überlappungen je Richtung: gesendet wird der eigene Rand, empfangen in die Randzeilen bzw. Randworte
+ * die Ecken werden mit ausgetauscht, damit auch die diagonalen Nachbarzellen stimmen
+ */
+void GOL_ueberlappung_setzen(GOL_ueberlappung *_u, MPI_Datatype _zeile, MPI_Datatype _spalte, MPI_Datatype _ecke, int _halo, int _size,
+		int _nw) {
+	_u[OBEN] = (GOL_ueberlappung) { _zeile, _halo, 1, 0, 1 };
+	_u[UNTEN] = (GOL_ueberlappung) { _zeile, _size, 1, _size + _halo, 1 };
+	_u[LINKS] = (GOL_ueberlappung) { _spalte, _halo, 1, _halo, 0 };
+	_u[RECHTS] = (GOL_ueberlappung) { _spalte, _halo, _nw, _halo, _nw + 1 };
+	_u[OBEN_LINKS] = (GOL_ueberlappung) { _ecke, _halo, 1, 0, 0 };
+	_u[UNTEN_RECHTS] = (GOL_ueberlappung) { _ecke, _size, _nw, _size + _halo, _nw + 1 };
+	_u[OBEN_RECHTS] = (GOL_ueberlappung) { _ecke, _halo, _nw, 0, _nw + 1 };
+	_u[UNTEN_LINKS] = (GOL_ueberlappung) { _ecke, _size, 1, _size + _halo, 0 };
+}
+
+/**
+ * Spielfelder für den Austausch: im Fenster liegen beide Spielfelder eines Procs hintereinander in seinem eigenen
+ * Abschnitt (alloc_shared_noncontig); jeder Proc füllt seinen Abschnitt selbst mit Nullen, die Seiten liegen so bei ihm
+ */
+void GOL_austausch_felder(GOL_austausch *_a, MPI_Comm _cart, int _zeilen, int _worte, int _fenster) {
+	int b, i; // für Schleifen
+	int knoten_procs = 0; // Procs auf dem Knoten
+	uint64_t *daten = NULL; // eigener Abschnitt des Fensters
+	MPI_Info info; // Hinweise für das Fenster
+
+	_a->knoten = MPI_COMM_NULL;
+	_a->fenster = MPI_WIN_NULL;
+#if MPI_VERSION >= 3
+	if (optionen.fenster && _fenster) {
+		MPI_Comm_split_type(_cart, MPI_COMM_TYPE_SHARED, 0, MPI_INFO_NULL, &_a->knoten);
+		MPI_Comm_size(_a->knoten, &knoten_procs);
+		if (knoten_procs > 1) {
+			MPI_Info_create(&info);
+			MPI_Info_set(info, "alloc_shared_noncontig", "true");
+			MPI_Win_allocate_shared((MPI_Aint) 2 * _zeilen * _worte * sizeof(uint64_t), sizeof(uint64_t), info, _a->knoten, &daten,
+					&_a->fenster);
+			MPI_Info_free(&info);
+			memset(daten, 0, (size_t) 2 * _zeilen * _worte * sizeof(uint64_t));
+		} else {
+			MPI_Comm_free(&_a->knoten); // allein auf dem Knoten: eigener Speicher
+		}
+	}
+#endif
+	if (_a->fenster == MPI_WIN_NULL) {
+		_a->feld[0] = malloc2D_bits(_zeilen, _worte);
+		_a->feld[1] = malloc2D_bits(_zeilen, _worte);
+		return;
+	}
+	for (b = 0; b < 2; b++) {
+		_a->feld[b] = (uint64_t **) malloc(_zeilen * sizeof(uint64_t*));
+		for (i = 0; i < _zeilen; i++)
+			_a->feld[b][i] = daten + ((size_t) b * _zeilen + i) * _worte;
+	}
+}
+
+/**
+ * Requests für den Austausch anlegen
+ * Tag = Richtung, in die gesendet wird, wie bisher; die Quittung für den Rand aus Richtung d geht mit Tag 8 + d zurück
+ * Lage des Randes, den ein Nachbar im Fenster bereithält: seine Überlappung in die Gegenrichtung, berechnet aus seiner
+ * Zeilen- und Wortzahl (MPI_Allgather über den Knoten) und der Basisadresse seines Abschnitts (MPI_Win_shared_query)
+ */
+void GOL_austausch_anlegen(GOL_austausch *_a, MPI_Comm _cart, const int *_nachbar, const GOL_ueberlappung *_u, int _halo, int _size,
+		int _nw) {
+	int b, d; // für Schleifen
+	int eigen[2] = { _size, _nw }; // eigene Zeilen und Worte
+	int *geometrie; // Zeilen und Worte aller Procs des Knotens
+	int n_knoten, rang, size_n, nw_n; // Procs des Knotens, Rang des Nachbarn im Knoten, seine Zeilen und Worte
+	MPI_Group cart_gruppe, knoten_gruppe; // zum Übersetzen der Ränge
+	GOL_ueberlappung u_nachbar[8]; // Lage der Überlappungen beim Nachbarn
+	MPI_Aint groesse; // Größe seines Abschnitts
+	int einheit; // Einheit seines Abschnitts
+	uint64_t *basis; // Anfang seines Abschnitts
+
+	_a->n_quittung = 0;
+	for (d = 0; d < 8; d++) {
+		_a->nachbar[d] = _nachbar[d];
+		_a->gemeinsam[d] = 0;
+		_a->form[d][0] = (d == LINKS || d == RECHTS) ? _size : _halo;
+		_a->form[d][1] = (d == OBEN || d == UNTEN) ? _nw : 1;
+	}
+
+#if MPI_VERSION >= 3
+	if (_a->fenster != MPI_WIN_NULL) {
+		MPI_Comm_size(_a->knoten, &n_knoten);
+		geometrie = (int*) malloc(2 * n_knoten * sizeof(int));
+		MPI_Allgather(eigen, 2, MPI_INT, geometrie, 2, MPI_INT, _a->knoten);
+		MPI_Comm_group(_cart, &cart_gruppe);
+		MPI_Comm_group(_a->knoten, &knoten_gruppe);
+		for (d = 0; d < 8; d++) {
+			if (_a->nachbar[d] == MPI_PROC_NULL) continue;
+			MPI_Group_translate_ranks(cart_gruppe, 1, &_a->nachbar[d], knoten_gruppe, &rang);
+			if (rang == MPI_UNDEFINED) continue;
+			_a->gemeinsam[d] = 1;
+			MPI_Win_shared_query(_a->fenster, rang, &groesse, &einheit, &basis);
+			size_n = geometrie[2 * rang];
+			nw_n = geometrie[2 * rang + 1];
+			GOL_ueberlappung_setzen(u_nachbar, MPI_DATATYPE_NULL, MPI_DATATYPE_NULL, MPI_DATATYPE_NULL, _halo, size_n, nw_n);
+			_a->quelle_worte[d] = nw_n + 2;
+			for (b = 0; b < 2; b++)
+				_a->quelle[b][d] = basis + ((size_t) b * (size_n + 2 * _halo) + u_nachbar[d ^ 1].sende_zeile) * (nw_n + 2)
+						+ u_nachbar[d ^ 1].sende_wort;
+		}
+		MPI_Group_free(&cart_gruppe);
+		MPI_Group_free(&knoten_gruppe);
+		free(geometrie);
+	}
+#endif
+
+	for (d = 0; d < 8; d++) {
+		if (_a->gemeinsam[d]) {
+			MPI_Recv_init(NULL, 0, MPI_BYTE, _a->nachbar[d], d ^ 1, _cart, &_a->bereit[2 * d]);
+			MPI_Send_init(NULL, 0, MPI_BYTE, _a->nachbar[d], d, _cart, &_a->bereit[2 * d + 1]);
+			MPI_Recv_init(NULL, 0, MPI_BYTE, _a->nachbar[d], 8 + (d ^ 1), _cart, &_a->quittung[2 * d]);
+			MPI_Send_init(NULL, 0, MPI_BYTE, _a->nachbar[d], 8 + d, _cart, &_a->quittung[2 * d + 1]);
+			for (b = 0; b < 2; b++)
+				_a->hole[b][d] = _a->sende[b][d][0] = _a->sende[b][d][1] = MPI_REQUEST_NULL;
+		} else {
+			_a->bereit[2 * d] = _a->bereit[2 * d + 1] = _a->quittung[2 * d] = _a->quittung[2 * d + 1] = MPI_REQUEST_NULL;
+			for (b = 0; b < 2; b++) {
+				MPI_Recv_init(&_a->feld[b][_u[d].hole_zeile][_u[d].hole_wort], 1, _u[d].typ, _a->nachbar[d], d ^ 1, _cart, &_a->hole[b][d]);
+				MPI_Send_init(&_a->feld[b][_u[d].sende_zeile][_u[d].sende_wort], 0, _u[d].typ, _a->nachbar[d], d, _cart, &_a->sende[b][d][0]);
+				MPI_Send_init(&_a->feld[b][_u[d].sende_zeile][_u[d].sende_wort], 1, _u[d].typ, _a->nachbar[d], d, _cart, &_a->sende[b][d][1]);
+			}
+		}
+	}
+}
+
+/**
+ * Austausch beginnen: Nachbarn im Fenster bekommen nur "Generation fertig", alle anderen die Überlappung
+ */
+void GOL_austausch_starten(GOL_austausch *_a, uint64_t **_feld, const int *_senden) {
+	int b = (_feld == _a->feld[1]); // Spielfeld, in dem die Generation steht
+	int d; // für Schleife
+
+	for (d = 0; d < 8; d++) {
+		if (_a->gemeinsam[d]) {
+			_a->laufend[2 * d] = _a->bereit[2 * d];
+			_a->laufend[2 * d + 1] = _a->bereit[2 * d + 1];
+		} else {
+			_a->laufend[2 * d] = _a->hole[b][d];
+			_a->laufend[2 * d + 1] = _a->sende[b][d][_senden[d] != 0];
+		}
+	}
+	MPI_Startall(16, _a->laufend);
+}
+
+/**
+ * Austausch beenden: Ränder der Nachbarn im Fenster zeilenweise kopieren, aber nur Zeilen, die sich gegenüber der
+ * Überlappung im Spielfeld geändert haben (dort steht die Überlappung von vor zwei Runden), danach quittieren
+ */
+void GOL_austausch_beenden(GOL_austausch *_a, uint64_t **_feld, const GOL_ueberlappung *_u, int *_erhalten) {
+	int b = (_feld == _a->feld[1]); // Spielfeld, in dem die Generation steht
+	int d, i; // für Schleifen
+	int anzahl; // empfangene Überlappungen
+	size_t laenge; // Bytes einer Zeile der Überlappung
+	uint64_t *von, *nach; // Zeile beim Nachbarn und im eigenen Spielfeld
+	MPI_Status status[16]; // für Waitall
+
+	MPI_Waitall(16, _a->laufend, status);
+	for (d = 0; d < 8; d++) {
+		_erhalten[d] = 0;
+		if (_a->nachbar[d] == MPI_PROC_NULL) continue;
+		if (!_a->gemeinsam[d]) {
+			MPI_Get_count(&status[2 * d], _u[d].typ, &anzahl);
+			_erhalten[d] = (anzahl > 0);
+			continue;
+		}
+		laenge = (size_t) _a->form[d][1] * sizeof(uint64_t);
+		for (i = 0; i < _a->form[d][0]; i++) {
+			von = _a->quelle[b][d] + (size_t) i * _a->quelle_worte[d];
+			nach = &_feld[_u[d].hole_zeile + i][_u[d].hole_wort];
+			if (memcmp(nach, von, laenge) != 0) {
+				memcpy(nach, von, laenge);
+				_erhalten[d] = 1;
+			}
+		}
+		_a->laufend_quittung[_a->n_quittung++] = _a->quittung[2 * d];
+		_a->laufend_quittung[_a->n_quittung++] = _a->quittung[2 * d + 1];
+	}
+	if (_a->n_quittung > 0) MPI_Startall(_a->n_quittung, _a->laufend_quittung);
+}
+
+/**
+ * Warten, bis die Nachbarn im Fenster den eigenen Rand gelesen haben
+ */
+void GOL_austausch_quittung(GOL_austausch *_a) {
+	if (_a->n_quittung > 0) MPI_Waitall(_a->n_quittung, _a->laufend_quittung, MPI_STATUSES_IGNORE);
+	_a->n_quittung = 0;
+}
+
+/**
+ * Requests freigeben (die Spielfelder bleiben)
+ */
+void GOL_austausch_freigeben(GOL_austausch *_a) {
+	int b, d, i; // für Schleifen
+
+	GOL_austausch_quittung(_a);
+	for (d = 0; d < 8; d++) {
+		for (i = 0; i < 2; i++) {
+			if (_a->bereit[2 * d + i] != MPI_REQUEST_NULL) MPI_Request_free(&_a->bereit[2 * d + i]);
+			if (_a->quittung[2 * d + i] != MPI_REQUEST_NULL) MPI_Request_free(&_a->quittung[2 * d + i]);
+			for (b = 0; b < 2; b++)
+				if (_a->sende[b][d][i] != MPI_REQUEST_NULL) MPI_Request_free(&_a->sende[b][d][i]);
+		}
+		for (b = 0; b < 2; b++)
+			if (_a->hole[b][d] != MPI_REQUEST_NULL) MPI_Request_free(&_a->hole[b][d]);
+	}
+}
+
+/**
+ * Spielfelder freigeben (und das Fenster, kollektiv über den Knoten)
+ */
+void GOL_austausch_felder_freigeben(GOL_austausch *_a) {
+	if (_a->fenster == MPI_WIN_NULL) {
+		free2D_bits(_a->feld[0]);
+		free2D_bits(_a->feld[1]);
+		return;
+	}
+#if MPI_VERSION >= 3
+	free(_a->feld[0]);
+	free(_a->feld[1]);
+	MPI_Win_free(&_a->fenster);
+	MPI_Comm_free(&_a->knoten);
+#endif
+}
+
+/**
+ * Neue Zeilengrenzen der Prozesszeilen (Bänder): die Rechenzeit eines Bandes gilt als gleichmäßig über seine Zeilen
+ * verteilt, jede Grenze wird dorthin verschoben, wo die aufsummierte Zeit ihren Anteil an der Gesamtzeit erreicht.
+ * Gegen Hin- und Herschieben: erst ab optionen.umverteilen_schwelle Prozent Ungleichgewicht (langsamstes Band
+ * gegenüber dem Mittel), jede Grenze geht nur die halbe Strecke, und höchstens so weit, dass beide Bänder die
+ * Hälfte ihrer Zeilen über halo hinaus behalten (Zeilen kommen so nur vom direkten Nachbarn, jedes Band behält
+ * mindestens halo Zeilen für die Überlappung).
+ */
+int GOL_grenzen_ausgleichen(const double *_zeiten, const int *_grenzen, int *_neu, int _baender, int _halo, double *_ungleich) {
+	int b, j; // für Schleifen
+	int grenze, spiel; // neue Grenze und größte erlaubte Verschiebung
+	int geaendert = 0; // mindestens eine Grenze verschoben?
+	double summe = 0, max_zeit = 0; // gesamte und größte Rechenzeit der Bänder
+	double ziel, kumuliert = 0, lage; // Zeitanteil bis zur Grenze b, Zeit der Bänder vor j, ideale Lage der Grenze
+
+	for (b = 0; b <= _baender; b++)
+		_neu[b] = _grenzen[b];
+	for (b = 0; b < _baender; b++) {
+		summe += _zeiten[b];
+		if (_zeiten[b] > max_zeit) max_zeit = _zeiten[b];
+	}
+	*_ungleich = (summe > 0) ? 100.0 * (max_zeit * _baender / summe - 1) : 0;
+	if (summe <= 0 || *_ungleich <= optionen.umverteilen_schwelle) return 0;
+
+	for (b = 1, j = 0; b < _baender; b++) {
+		// Band j, in dem der Anteil b / _baender der Gesamtzeit erreicht wird
+		ziel = summe * b / _baender;
+		while (j < _baender - 1 && kumuliert + _zeiten[j] <= ziel)
+			kumuliert += _zeiten[j++];
+		lage = _grenzen[j] + ((_zeiten[j] > 0) ? (ziel - kumuliert) / _zeiten[j] : 0) * (_grenzen[j + 1] - _grenzen[j]);
+
+		// gedämpft und begrenzt verschieben
+		spiel = _grenzen[b] - _grenzen[b - 1];
+		if (_grenzen[b + 1] - _grenzen[b] < spiel) spiel = _grenzen[b + 1] - _grenzen[b];
+		spiel = (spiel - _halo) / 2;
+		grenze = _grenzen[b] + (int) ((lage - _grenzen[b]) / 2);
+		if (grenze > _grenzen[b] + spiel) grenze = _grenzen[b] + spiel;
+		if (grenze < _grenzen[b] - spiel) grenze = _grenzen[b] - spiel;
+		_neu[b] = grenze;
+		geaendert |= (grenze != _grenzen[b]);
+	}
+	return geaendert;
+}
+
+/**
+ * Zieht das eigene Teilspielfeld auf die neuen Zeilen um: behaltene Zeilen werden kopiert, an jeder verschobenen
+ * Grenze gibt einer der beiden Nachbarn ganze Zeilen (mit Randworten, zusammenhängend) an den anderen ab
+ * Tag = Richtung, in die gesendet wird (wie beim Austausch der Überlappungen)
+ */
+uint64_t **GOL_zeilen_umziehen(uint64_t **_feld, MPI_Comm _comm, int _oben, int _unten, int _halo, int _worte, int _alt_von, int _alt_anzahl,
+		int _neu_von, int _neu_anzahl) {
+	int alt_bis = _alt_von + _alt_anzahl, neu_bis = _neu_von + _neu_anzahl; // erste Zeile nach dem alten bzw. neuen Bereich
+	int von, bis; // behaltene Zeilen
+	int n = 0; // Anzahl der Requests
+	MPI_Request request[2]; // höchstens eine Nachricht je Grenze
+	uint64_t **neu = malloc2D_bits(_neu_anzahl + 2 * _halo, _worte);
+
+	von = (_alt_von > _neu_von) ? _alt_von : _neu_von;
+	bis = (alt_bis < neu_bis) ? alt_bis : neu_bis;
+	if (von < bis) memcpy(neu[_halo + von - _neu_von], _feld[_halo + von - _alt_von], (size_t) (bis - von) * _worte * sizeof(uint64_t));
+
+	// obere Grenze: Zeilen vom oberen Nachbarn übernehmen bzw. an ihn abgeben
+	if (_neu_von < _alt_von)
+		MPI_Irecv(neu[_halo], (_alt_von - _neu_von) * _worte, MPI_UINT64_T, _oben, UNTEN, _comm, &request[n++]);
+	else if (_neu_von > _alt_von)
+		MPI_Isend(_feld[_halo], (_neu_von - _alt_von) * _worte, MPI_UINT64_T, _oben, OBEN, _comm, &request[n++]);
+
+	// untere Grenze: Zeilen vom unteren Nachbarn übernehmen bzw. an ihn abgeben
+	if (neu_bis > alt_bis)
+		MPI_Irecv(neu[_halo + alt_bis - _neu_von], (neu_bis - alt_bis) * _worte, MPI_UINT64_T, _unten, OBEN, _comm, &request[n++]);
+	else if (neu_bis < alt_bis)
+		MPI_Isend(_feld[_halo + neu_bis - _alt_von], (alt_bis - neu_bis) * _worte, MPI_UINT64_T, _unten, UNTEN, _comm, &request[n++]);
+
+	MPI_Waitall(n, request, MPI_STATUSES_IGNORE);
+	free2D_bits(_feld);
+	return neu;
+}
+
+/**
+ * Anzahl der gesetzten Bits eines Wortes ohne Compiler-Unterstützung
+ */
+int GOL_popcount_portabel(uint64_t _w) {
+	int n; // Anzahl
+	for (n = 0; _w != 0; n++)
+		_w &= _w - 1; // niedrigstes gesetztes Bit löschen
+	return n;
+}
+
+/**
+ * Zählt die lebenden Zellen eines Spielfelds (Randzeilen und Randworte zählen nicht mit)
+ */
+long long GOL_lebende(uint64_t **_feld, int _zeilen, int _nw) {
+	int i, w; // für Schleifen
+	long long summe = 0;
+	for (i = 1; i <= _zeilen; i++) {
+		for (w = 1; w <= _nw; w++)
+			summe += GOL_POPCOUNT(_feld[i][w]);
+	}
+	return summe;
+}
+
+/**
+ * Schreibt die Zeilen [_von, _bis) eines Spielfelds als Bildzeilen eines PBM-Bildes (_zeile: Puffer für eine Bildzeile)
+ * im PBM-Format ist das höchste Bit eines Bytes die linke Zelle, im Spielfeld das niedrigste
+ */
+static void GOL_pbm_zeilen(FILE *_f, uint64_t **_feld, int _von, int _bis, int _dim, unsigned char *_zeile) {
+	int i, b, n; // für Schleifen
+	int bytes = (_dim + 7) / 8; // Bytes pro Bildzeile
+	for (i = _von; i < _bis; i++) {
+		for (b = 0; b < bytes; b++) {
+			unsigned char x = (unsigned char) (_feld[i][1 + b / 8] >> (8 * (b % 8)));
+			unsigned char r = 0;
+			for (n = 0; n < 8; n++)
+				r |= ((x >> n) & 1) << (7 - n); // Bitreihenfolge umdrehen
+			_zeile[b] = r;
+		}
+		fwrite(_zeile, 1, bytes, _f);
+	}
+}
+
+/**
+ * Speichert das Vollspielfeld als PBM-Bild (binäres P4, lebende Zellen schwarz)
+ */
+int GOL_pbm_schreiben(const char *_datei, uint64_t **_feld, int _dim) {
+	unsigned char *zeile = (unsigned char *) malloc((_dim + 7) / 8);
+	FILE *f = fopen(_datei, "wb");
+
+	if (f == NULL) {
+		printf("Error: %s kann nicht geschrieben werden\n", _datei);
+		free(zeile);
+		return -1;
+	}
+	fprintf(f, "P4\n%d %d\n", _dim, _dim);
+	GOL_pbm_zeilen(f, _feld, 1, _dim + 1, _dim, zeile);
+	fclose(f);
+	free(zeile);
+	return 0;
+}
+
+/**
+ * Musterdateien: RLE ("x = B, y = H" nach #-Kommentaren, Läufe aus b/o/$ bis !) und Klartext .cells
+ * (!-Kommentarzeilen, dann eine Zeile pro Musterzeile aus . und O). Der Leser ist ein Zustandsautomat,
+ * der die Datei blockweise verarbeitet; er kann an jeder Stelle mit bekanntem Zustand fortgesetzt werden.
+ */
+enum { GOL_RLE, GOL_CELLS };
+#define GOL_MUSTER_BLOCK (1 << 20) // Bytes pro Lesevorgang
+typedef struct {
+	int format; // GOL_RLE oder GOL_CELLS
+	long long zeile, spalte; // aktuelle Position im Muster
+	long long zahl; // RLE: bisher gelesene Wiederholungszahl
+	long long breite; // grösste erreichte Spalte
+	int zeilenanfang, kommentar; // .cells: am Anfang einer Zeile, Kommentarzeile wird überlesen
+	int fertig; // Ende der Daten (RLE: !) bzw. des Zielbereichs erreicht
+} GOL_leser;
+
+/**
+ * Zielbereich beim Dekodieren: Musterzeilen [z_von, z_bis) und Musterspalten [s_von, s_bis) landen in
+ * feld[zeile + versatz_z] an Zelle spalte + versatz_s + 1
+ */
+typedef struct {
+	uint64_t **feld;
+	long long z_von, z_bis, s_von, s_bis;
+	long long versatz_z, versatz_s;
+} GOL_muster_ziel;
+
+/**
+ * Lebenden Lauf der Länge _n ab der aktuellen Position in den Zielbereich eintragen
+ */
+static void GOL_muster_setzen(const GOL_leser *_l, long long _n, const GOL_muster_ziel *_ziel) {
+	long long s, s_von, s_bis; // für Schleife, Spalten des Laufs im Zielbereich
+	if (_ziel == NULL || _l->zeile < _ziel->z_von || _l->zeile >= _ziel->z_bis) return;
+	s_von = (_l->spalte > _ziel->s_von) ? _l->spalte : _ziel->s_von;
+	s_bis = (_l->spalte + _n < _ziel->s_bis) ? _l->spalte + _n : _ziel->s_bis;
+	for (s = s_von; s < s_bis; s++)
+		ZELLE_SETZEN(_ziel->feld[_l->zeile + _ziel->versatz_z], s + _ziel->versatz_s + 1);
+}
+
+/**
+ * Dekodiert _n Bytes ab _p weiter; ohne Ziel wird nur die Position mitgezählt
+ * hört hinter dem Zielbereich auf und liefert die Anzahl der verarbeiteten Bytes
+ */
+static long long GOL_muster_dekodieren(GOL_leser *_l, const char *_p, long long _n, const GOL_muster_ziel *_ziel) {
+	long long i, anzahl; // für Schleife, Länge des Laufs
+	char c; // aktuelles Zeichen
+
+	for (i = 0; i < _n && !_l->fertig; i++) {
+		if (_ziel != NULL && _l->zeile >= _ziel->z_bis) break;
+		c = _p[i];
+		if (_l->format == GOL_RLE) {
+			if (c >= '0' && c <= '9') {
+				_l->zahl = 10 * _l->zahl + (c - '0');
+				continue;
+			}
+			anzahl = (_l->zahl > 0) ? _l->zahl : 1;
+			if (c == '$') {
+				_l->zeile += anzahl;
+				_l->spalte = 0;
+			} else if (c == '!') {
+				_l->fertig = 1;
+			} else if (c == 'b' || c == '.') {
+				_l->spalte += anzahl;
+			} else if ((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z')) {
+				// o und alle weiteren Zustände von Mehrzustandsregeln gelten als lebend
+				GOL_muster_setzen(_l, anzahl, _ziel);
+				_l->spalte += anzahl;
+			} else {
+				continue; // Leerraum und Zeilenumbrüche
+			}
+			_l->zahl = 0;
+		} else {
+			if (c == '\n') {
+				if (!_l->kommentar) {
+					_l->zeile++;
+					_l->spalte = 0;
+				}
+				_l->zeilenanfang = 1;
+				_l->kommentar = 0;
+				continue;
+			}
+			if (c == '\r') continue;
+			if (_l->zeilenanfang && c == '!') _l->kommentar = 1;
+			_l->zeilenanfang = 0;
+			if (_l->kommentar) continue;
+			if (c == 'O' || c == '*') GOL_muster_setzen(_l, 1, _ziel);
+			_l->spalte++;
+		}
+		if (_l->spalte > _l->breite) _l->breite = _l->spalte;
+	}
+	return i;
+}
+
+/**
+ * Hintereinanderausführung zweier Abschnitte (Zeilenvorschub, Spalte, Ende) für MPI_Exscan: _ein liegt vor _einaus.
+ * Mit Zeilenvorschub beginnt die Spalte im zweiten Abschnitt neu, nach dem Ende zählt nichts mehr.
+ */
+static void GOL_muster_verknuepfen(void *_ein, void *_einaus, int *_n, MPI_Datatype *_typ) {
+	long long *a = (long long *) _ein, *b = (long long *) _einaus; // je Zeile, Spalte, Ende
+	int i; // für Schleife
+	(void) _typ;
+	for (i = 0; i < *_n; i++, a += 3, b += 3) {
+		if (a[2]) {
+			b[0] = a[0];
+			b[1] = a[1];
+			b[2] = 1;
+		} else {
+			b[1] = (b[0] > 0) ? b[1] : a[1] + b[1];
+			b[0] = a[0] + b[0];
+		}
+	}
+}
+
+/**
+ * Kopf einer Musterdatei lesen (nur ROOT): kopf = { Format (-1 = Fehler), Beginn der Daten, Breite, Höhe }
+ * bei .cells sind Breite und Höhe erst nach dem Durchlesen bekannt (-1)
+ */
+static void GOL_muster_kopf(MPI_File _f, MPI_Offset _groesse, long long *_kopf) {
+	char puffer[65536 + 1]; // Anfang der Datei
+	char *zeile, *ende; // aktuelle Zeile und ihr Ende
+	long long b, h; // Breite und Höhe aus dem RLE-Kopf
+	int rle_kommentar = 0; // #-Kommentare gesehen -> RLE mit Kopfzeile erwartet
+	int n; // gelesene Bytes
+	MPI_Status status; // für MPI_Get_count
+
+	_kopf[0] = -1;
+	MPI_File_read_at(_f, 0, puffer, (_groesse < 65536) ? (int) _groesse : 65536, MPI_CHAR, &status);
+	MPI_Get_count(&status, MPI_CHAR, &n);
+	puffer[n] = '\0';
+	for (zeile = puffer; *zeile != '\0'; zeile = ende + 1) {
+		if ((ende = strchr(zeile, '\n')) == NULL) ende = zeile + strlen(zeile) - 1;
+		if (zeile[0] == '#') {
+			rle_kommentar = 1;
+		} else if (zeile[0] != '!') {
+			if (sscanf(zeile, " x = %lld , y = %lld", &b, &h) == 2) {
+				_kopf[0] = GOL_RLE;
+				_kopf[1] = ende + 1 - puffer;
+				_kopf[2] = b;
+				_kopf[3] = h;
+			} else if (!rle_kommentar) {
+				_kopf[0] = GOL_CELLS;
+				_kopf[1] = zeile - puffer;
+				_kopf[2] = _kopf[3] = -1;
+			}
+			return;
+		}
+	}
+}
+
+/**
+ * Sucht ab _pos die erste Stelle, an der ein Abschnitt beginnen darf (RLE: nicht mitten in einer Zahl,
+ * .cells: am Zeilenanfang); liest dafür von _pos - 1 an blockweise, höchstens bis _groesse
+ */
+static MPI_Offset GOL_muster_grenze(MPI_File _f, MPI_Offset _pos, MPI_Offset _groesse, int _format, char *_puffer) {
+	MPI_Offset a = _pos - 1; // gelesener Block beginnt hier
+	int i, n; // für Schleife, gelesene Bytes
+	MPI_Status status; // für MPI_Get_count
+
+	while (a < _groesse - 1) {
+		MPI_File_read_at(_f, a, _puffer, (_groesse - a < GOL_MUSTER_BLOCK) ? (int) (_groesse - a) : GOL_MUSTER_BLOCK, MPI_CHAR, &status);
+		MPI_Get_count(&status, MPI_CHAR, &n);
+		if (n <= 0) break;
+		for (i = 0; i < n - 1; i++) {
+			if (_format == GOL_RLE ? (_puffer[i] < '0' || _puffer[i] > '9') : (_puffer[i] == '\n')) return a + i + 1;
+		}
+		a += n - 1;
+	}
+	return _groesse;
+}
+
+/**
+ * Philox4x32-10 nach Salmon et al., "Parallel Random Numbers: As Easy as 1, 2, 3" (SC 2011):
+ * zehn Runden aus zwei 32x32->64-Bit-Multiplikationen, der Schlüssel wächst pro Runde um die Weyl-Konstanten
+ */
+void GOL_philox(uint32_t _zaehler[4], uint64_t _schluessel) {
+	uint32_t k0 = (uint32_t) _schluessel, k1 = (uint32_t) (_schluessel >> 32); // Schlüssel
+	uint64_t p0, p1; // Produkte
+	int r; // für Schleife
+	for (r = 0; r < 10; r++) {
+		p0 = (uint64_t) 0xd2511f53 * _zaehler[0];
+		p1 = (uint64_t) 0xcd9e8d57 * _zaehler[2];
+		_zaehler[0] = (uint32_t) (p1 >> 32) ^ _zaehler[1] ^ k0;
+		_zaehler[2] = (uint32_t) (p0 >> 32) ^ _zaehler[3] ^ k1;
+		_zaehler[1] = (uint32_t) p1;
+		_zaehler[3] = (uint32_t) p0;
+		k0 += 0x9e3779b9;
+		k1 += 0xbb67ae85;
+	}
+}
+
+/**
+ * Ein Wort mit 64 unabhängigen Zellen der Dichte _dichte / 65536: die Bits der Dichte werden vom niedrigsten
+ * gesetzten an mit je einem Zufallswort verknüpft (Bit 1: oder, Bit 0: und), jedes Mal halbiert sich der Abstand
+ * zur Zieldichte; für 50 % reicht also ein Zufallswort, für 1/65536 sind es 16 (ein Philox-Aufruf für zwei)
+ */
+uint64_t GOL_zufall_wort(uint64_t _saat, int _zeile, int _wort, int _dichte) {
+	uint32_t zaehler[4]; // Zähler und Ergebnis von Philox
+	uint64_t wort = 0, zufall = 0;
+	int b, n; // Bit der Dichte, Anzahl der verbrauchten Zufallsworte
+	if (_dichte <= 0) return 0;
+	if (_dichte >= 65536) return ~(uint64_t) 0;
+	for (b = 0; !((_dichte >> b) & 1); b++)
+		;
+	for (n = 0; b < 16; b++, n++) {
+		if (n % 2 == 0) {
+			zaehler[0] = (uint32_t) _zeile;
+			zaehler[1] = (uint32_t) _wort;
+			zaehler[2] = (uint32_t) (n / 2);
+			zaehler[3] = 0;
+			GOL_philox(zaehler, _saat);
+			zufall = zaehler[0] | (uint64_t) zaehler[1] << 32;
+		} else {
+			zufall = zaehler[2] | (uint64_t) zaehler[3] << 32;
+		}
+		wort = ((_dichte >> b) & 1) ? (wort | zufall) : (wort & zufall);
+	}
+	return wort;
+}
+
+void GOL_zufall_fuellen(uint64_t **_feld, uint64_t **_zwischen, int _z, int _zeilen, int _nw, int _spalten, int _zeile0, int _wort0) {
+	int i, w; // für Schleifen
+	int dichte = (int) (optionen.dichte * 65536 + 0.5); // Dichte in 1/65536
+	uint64_t maske = GOL_maske(_spalten); // gültige Bits im letzten eigenen Wort
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) private(w)
+#endif
+	for (i = 0; i < _zeilen; i++) {
+		if (_zwischen != NULL) memset(_zwischen[_z + i], 0, (_nw + 2) * sizeof(uint64_t));
+		for (w = 1; w <= _nw; w++)
+			_feld[_z + i][w] = GOL_zufall_wort(optionen.saat, _zeile0 + i, _wort0 + w - 1, dichte);
+		_feld[_z + i][_nw] &= maske;
+	}
+}
+
+/**
+ * Liest den Bereich [_von, _bis) der Datei blockweise durch den Leser (bis er fertig ist)
+ */
+static void GOL_muster_strom(MPI_File _f, MPI_Offset _von, MPI_Offset _bis, GOL_leser *_l, const GOL_muster_ziel *_ziel, char *_puffer) {
+	int n; // gelesene Bytes
+	MPI_Status status; // für MPI_Get_count
+
+	while (_von < _bis && !_l->fertig) {
+		MPI_File_read_at(_f, _von, _puffer, (_bis - _von < GOL_MUSTER_BLOCK) ? (int) (_bis - _von) : GOL_MUSTER_BLOCK, MPI_CHAR, &status);
+		MPI_Get_count(&status, MPI_CHAR, &n);
+		if (n <= 0 || GOL_muster_dekodieren(_l, _puffer, n, _ziel) < n) break;
+		_von += n;
+	}
+}
+
+int GOL_muster_laden(const char *_datei, MPI_Comm _comm, int _dim, uint64_t **_feld, int _zeile0, int _z_von, int _z_anzahl, int _s_von,
+		int _s_anzahl) {
+	int my_rank, nprocs; // eigene Prozess-ID und Prozessanzahl
+	int p; // für Schleife
+	MPI_File f; // Musterdatei
+	MPI_Offset groesse; // Dateigrösse in Bytes
+	long long kopf[4]; // Format, Beginn der Daten, Breite, Höhe
+	long long mein[3], vorher[3] = { 0, 0, 0 }, gesamt[3]; // Wirkung des eigenen Abschnitts, Zustand an seinem Beginn, ganze Datei
+	long long *zustaende; // Zustand am Beginn jedes Abschnitts (Zeile, Spalte, Ende)
+	long long breite, x0, y0; // Musterbreite, Position der linken oberen Musterzelle im Spielfeld
+	MPI_Offset *grenzen, grenze; // Beginn der Abschnitte (Bytes), eigener Beginn
+	MPI_Datatype zustand_typ; // Zeile, Spalte, Ende
+	MPI_Op verknuepfen; // Hintereinanderausführung von Abschnitten
+	GOL_leser leser; // Zustandsautomat
+	GOL_muster_ziel ziel; // eigener Bereich im Muster
+	char *puffer; // Lesepuffer
+
+	MPI_Comm_rank(_comm, &my_rank);
+	MPI_Comm_size(_comm, &nprocs);
+	if (MPI_File_open(_comm, (char *) _datei, MPI_MODE_RDONLY, MPI_INFO_NULL, &f) != MPI_SUCCESS) {
+		if (my_rank == ROOT) printf("Error: Muster %s kann nicht gelesen werden\n", _datei);
+		return -1;
+	}
+	MPI_File_get_size(f, &groesse);
+
+	// Kopf liest nur ROOT, alle anderen bekommen Format, Beginn der Daten und Grösse
+	if (my_rank == ROOT) GOL_muster_kopf(f, groesse, kopf);
+	MPI_Bcast(kopf, 4, MPI_LONG_LONG, ROOT, _comm);
+	if (kopf[0] < 0) {
+		if (my_rank == ROOT) printf("Error: %s ist weder RLE noch .cells\n", _datei);
+		MPI_File_close(&f);
+		return -1;
+	}
+
+	puffer = (char *) malloc(GOL_MUSTER_BLOCK);
+	grenzen = (MPI_Offset *) malloc((nprocs + 1) * sizeof(MPI_Offset));
+	zustaende = (long long *) malloc(3 * nprocs * sizeof(long long));
+	memset(&leser, 0, sizeof(leser));
+	leser.format = (int) kopf[0];
+	leser.zeilenanfang = 1;
+	breite = kopf[2];
+	grenzen[0] = kopf[1];
+	grenzen[nprocs] = groesse;
+	memset(zustaende, 0, 3 * sizeof(long long));
+
+	/**
+	 * Zeilenindex: jeder Proc zählt in seinem Stück der Datei nur Zeilen und Spalten; die Zustände an den
+	 * Abschnittsgrenzen ergeben sich per MPI_Exscan. Entfällt bei RLE mit einem Proc (Grösse steht im Kopf).
+	 */
+	if (nprocs > 1 || kopf[0] == GOL_CELLS) {
+		grenze = kopf[1] + (groesse - kopf[1]) * my_rank / nprocs;
+		if (grenze > kopf[1]) grenze = GOL_muster_grenze(f, grenze, groesse, leser.format, puffer);
+		MPI_Allgather(&grenze, 1, MPI_OFFSET, grenzen, 1, MPI_OFFSET, _comm);
+
+		GOL_muster_strom(f, grenzen[my_rank], grenzen[my_rank + 1], &leser, NULL, puffer);
+		mein[0] = leser.zeile;
+		mein[1] = leser.spalte;
+		mein[2] = leser.fertig;
+
+		MPI_Type_contiguous(3, MPI_LONG_LONG, &zustand_typ);
+		MPI_Type_commit(&zustand_typ);
+		MPI_Op_create(GOL_muster_verknuepfen, 0, &verknuepfen);
+		MPI_Exscan(mein, vorher, 1, zustand_typ, verknuepfen, _comm);
+		if (my_rank == ROOT) vorher[0] = vorher[1] = vorher[2] = 0;
+		MPI_Allgather(vorher, 1, zustand_typ, zustaende, 1, zustand_typ, _comm);
+		MPI_Allreduce(mein, gesamt, 1, zustand_typ, verknuepfen, _comm);
+		MPI_Op_free(&verknuepfen);
+		MPI_Type_free(&zustand_typ);
+
+		if (kopf[0] == GOL_CELLS) {
+			MPI_Allreduce(&leser.breite, &breite, 1, MPI_LONG_LONG, MPI_MAX, _comm);
+			kopf[3] = gesamt[0] + (gesamt[1] > 0);
+		}
+	}
+
+	// Lage im Spielfeld: -versatz bzw. mittig
+	x0 = optionen.versatz_gesetzt ? optionen.versatz[0] : (_dim - breite) / 2;
+	y0 = optionen.versatz_gesetzt ? optionen.versatz[1] : (_dim - kopf[3]) / 2;
+	if (my_rank == ROOT && optionen.ausgabe)
+		printf("Muster %s: %lld x %lld Zellen bei (%lld, %lld)\n", _datei, breite, kopf[3], x0, y0);
+
+	// eigener Bereich in Musterkoordinaten
+	ziel.feld = _feld;
+	ziel.z_von = (_z_von - y0 > 0) ? _z_von - y0 : 0;
+	ziel.z_bis = _z_von + _z_anzahl - y0;
+	ziel.s_von = (_s_von - x0 > 0) ? _s_von - x0 : 0;
+	ziel.s_bis = _s_von + _s_anzahl - x0;
+	ziel.versatz_z = _zeile0 - _z_von + y0;
+	ziel.versatz_s = x0 - _s_von;
+
+	/**
+	 * eigene Zeilen dekodieren: ab dem letzten Abschnitt, der spätestens am Anfang der ersten eigenen Zeile beginnt,
+	 * bis hinter die letzte eigene Zeile
+	 */
+	if (ziel.z_von < ziel.z_bis && ziel.s_von < ziel.s_bis) {
+		for (p = nprocs - 1; p > 0; p--) {
+			if (!zustaende[3 * p + 2] && (zustaende[3 * p] < ziel.z_von || (zustaende[3 * p] == ziel.z_von && zustaende[3 * p + 1] == 0)))
+				break;
+		}
+		memset(&leser, 0, sizeof(leser));
+		leser.format = (int) kopf[0];
+		leser.zeilenanfang = 1;
+		leser.zeile = zustaende[3 * p];
+		leser.spalte = zustaende[3 * p + 1];
+		GOL_muster_strom(f, grenzen[p], groesse, &leser, &ziel, puffer);
+	}
+
+	MPI_File_close(&f);
+	free(puffer);
+	free(grenzen);
+	free(zustaende);
+	return 0;
+}
+
+/**
+ * Muster bandweise von oben nach unten dekodieren (-engine datei, ein Proc): die Datei wird nur einmal gelesen,
+ * jedes Band beginnt dort, wo das vorige aufgehört hat
+ * GOL_muster_baender_oeffnen: Kopf lesen (.cells: Grösse in einem Durchgang ohne Ziel bestimmen), Lage ausgeben; -1 = Fehler
+ * GOL_muster_band: Spielfeldzeilen [_z_von, _z_von + _z_anzahl) in _feld ab Zeile _zeile0 eintragen; -1 = Lesefehler
+ */
+typedef struct {
+	MPI_File datei; // Musterdatei
+	MPI_Offset pos, groesse; // nächster zu lesender Block, Dateigrösse
+	GOL_leser leser; // Zustandsautomat
+	long long x0, y0; // Position der linken oberen Musterzelle im Spielfeld
+	char *puffer; // Lesepuffer
+	long long n, i; // Bytes im Lesepuffer und davon schon verarbeitet
+} GOL_muster_baender;
+
+static int GOL_muster_baender_oeffnen(GOL_muster_baender *_m, const char *_datei, int _dim) {
+	long long kopf[4]; // Format, Beginn der Daten, Breite, Höhe
+
+	if (MPI_File_open(MPI_COMM_SELF, (char *) _datei, MPI_MODE_RDONLY, MPI_INFO_NULL, &_m->datei) != MPI_SUCCESS) {
+		printf("Error: Muster %s kann nicht gelesen werden\n", _datei);
+		return -1;
+	}
+	MPI_File_get_size(_m->datei, &_m->groesse);
+	GOL_muster_kopf(_m->datei, _m->groesse, kopf);
+	if (kopf[0] < 0) {
+		printf("Error: %s ist weder RLE noch .cells\n", _datei);
+		MPI_File_close(&_m->datei);
+		return -1;
+	}
+	_m->puffer = (char *) malloc(GOL_MUSTER_BLOCK);
+	memset(&_m->leser, 0, sizeof(_m->leser));
+	_m->leser.format = (int) kopf[0];
+	_m->leser.zeilenanfang = 1;
+	if (kopf[0] == GOL_CELLS) {
+		GOL_muster_strom(_m->datei, kopf[1], _m->groesse, &_m->leser, NULL, _m->puffer);
+		kopf[2] = _m->leser.breite;
+		kopf[3] = _m->leser.zeile + (_m->leser.spalte > 0);
+		memset(&_m->leser, 0, sizeof(_m->leser));
+		_m->leser.format = GOL_CELLS;
+		_m->leser.zeilenanfang = 1;
+	}
+
+	// Lage im Spielfeld: -versatz bzw. mittig
+	_m->x0 = optionen.versatz_gesetzt ? optionen.versatz[0] : (_dim - kopf[2]) / 2;
+	_m->y0 = optionen.versatz_gesetzt ? optionen.versatz[1] : (_dim - kopf[3]) / 2;
+	if (optionen.ausgabe) printf("Muster %s: %lld x %lld Zellen bei (%lld, %lld)\n", _datei, kopf[2], kopf[3], _m->x0, _m->y0);
+	_m->pos = kopf[1];
+	_m->n = _m->i = 0;
+	return 0;
+}
+
+static int GOL_muster_band(GOL_muster_baender *_m, uint64_t **_feld, int _zeile0, int _z_von, int _z_anzahl, int _dim) {
+	int n; // gelesene Bytes
+	MPI_Status status; // für MPI_Get_count
+	GOL_muster_ziel ziel; // Band in Musterkoordinaten
+
+	ziel.feld = _feld;
+	ziel.z_von = (_z_von - _m->y0 > 0) ? _z_von - _m->y0 : 0;
+	ziel.z_bis = _z_von + _z_anzahl - _m->y0;
+	ziel.s_von = (_m->x0 < 0) ? -_m->x0 : 0;
+	ziel.s_bis = _dim - _m->x0;
+	ziel.versatz_z = _zeile0 - _z_von + _m->y0;
+	ziel.versatz_s = _m->x0;
+	if (ziel.z_bis <= 0 || ziel.s_von >= ziel.s_bis) return 0;
+
+	// weiterlesen, bis der Leser hinter dem Band steht (Rest des Lesepuffers gehört dem nächsten Band)
+	while (!_m->leser.fertig) {
+		if (_m->i == _m->n) {
+			if (_m->pos >= _m->groesse) break;
+			MPI_File_read_at(_m->datei, _m->pos, _m->puffer, (_m->groesse - _m->pos < GOL_MUSTER_BLOCK) ? (int) (_m->groesse - _m->pos)
+					: GOL_MUSTER_BLOCK, MPI_CHAR, &status);
+			MPI_Get_count(&status, MPI_CHAR, &n);
+			if (n <= 0) return -1;
+			_m->pos += n;
+			_m->n = n;
+			_m->i = 0;
+		}
+		_m->i += GOL_muster_dekodieren(&_m->leser, _m->puffer + _m->i, _m->n - _m->i, &ziel);
+		if (_m->i < _m->n) break;
+	}
+	return 0;
+}
+
+static void GOL_muster_baender_schliessen(GOL_muster_baender *_m) {
+	MPI_File_close(&_m->datei);
+	free(_m->puffer);
+}
+
+/**
+ * Sicherungsdatei: 64 Byte Kopf ("GOLSICH1", Dimension, Runde, Worte pro Zeile als int64), danach das
+ * Spielfeld Zeile für Zeile mit GOL_worte(dim) Worten (ohne Randworte, Bits wie im Speicher, "native")
+ */
+#define GOL_SICHERUNG_KOPF 64
+
+/**
+ * Kopf einer Sicherung für ein Spielfeld _dim x _dim nach Runde _runde füllen
+ */
+static void GOL_sicherung_kopf_setzen(long long *_kopf, int _dim, int _runde) {
+	memset(_kopf, 0, GOL_SICHERUNG_KOPF);
+	memcpy(_kopf, "GOLSICH1", 8);
+	_kopf[1] = _dim;
+	_kopf[2] = _runde;
+	_kopf[3] = GOL_worte(_dim);
+}
+
+int GOL_sicherung_faellig(int _runde) {
+	return optionen.sicherung > 0 && _runde % optionen.sicherung == 0;
+}
+
+/**
+ * Signal merken: jedes Signal verlangt eine Sicherung, nach SIGTERM wird danach beendet
+ */
+void GOL_signal_fangen(int _signal) {
+	GOL_signal++;
+	if (_signal == SIGTERM) GOL_signal_ende = 1;
+}
+
+void GOL_sicherung_schreiben(GOL_sicherung *_s, MPI_Comm _comm, uint64_t **_feld, int _zeile0, int _dim, int _z_von, int _z_anzahl, int _w_von,
+		int _w_anzahl, int _runde) {
+	int my_rank; // eigene Prozess-ID
+	int i; // für Schleife
+	int groesse[2] = { _dim, GOL_worte(_dim) }, teil[2] = { _z_anzahl, _w_anzahl }, start[2] = { _z_von, _w_von }; // für die Dateiansicht
+	long long kopf[GOL_SICHERUNG_KOPF / sizeof(long long)]; // Kopf der Datei
+	char datei[300]; // temporäre Datei
+	MPI_Info info; // Hinweise für MPI-IO
+
+	// vorherige Sicherung abschließen, dann den eigenen Block kopieren (das Spielfeld rechnet gleich weiter)
+	GOL_sicherung_abschliessen(_s);
+	MPI_Comm_rank(_comm, &my_rank);
+	_s->comm = _comm;
+	_s->runde = _runde;
+	_s->puffer = (uint64_t *) malloc((size_t) _z_anzahl * _w_anzahl * sizeof(uint64_t));
+	for (i = 0; i < _z_anzahl; i++)
+		memcpy(&_s->puffer[(size_t) i * _w_anzahl], &_feld[_zeile0 + i][1], _w_anzahl * sizeof(uint64_t));
+
+	// erst in eine temporäre Datei schreiben, die alte Sicherung bleibt bis zum Abschluss gültig
+	snprintf(datei, sizeof(datei), "%s.tmp", optionen.sicherung_datei);
+	MPI_Info_create(&info);
+	MPI_Info_set(info, "romio_cb_write", "enable");
+	if (MPI_File_open(_comm, datei, MPI_MODE_WRONLY | MPI_MODE_CREATE, info, &_s->datei) != MPI_SUCCESS) {
+		if (my_rank == ROOT) printf("Error: Sicherung %s kann nicht geschrieben werden\n", datei);
+		_s->datei = MPI_FILE_NULL;
+		free(_s->puffer);
+		_s->puffer = NULL;
+		MPI_Info_free(&info);
+		return;
+	}
+	MPI_File_set_size(_s->datei, GOL_SICHERUNG_KOPF + (MPI_Offset) groesse[0] * groesse[1] * sizeof(uint64_t));
+	if (my_rank == ROOT) {
+		GOL_sicherung_kopf_setzen(kopf, _dim, _runde);
+		MPI_File_write_at(_s->datei, 0, kopf, GOL_SICHERUNG_KOPF, MPI_BYTE, MPI_STATUS_IGNORE);
+	}
+
+	// jeder Proc schreibt seinen Block direkt an seine Stelle (kollektiv, ohne Umweg über ROOT)
+	MPI_Type_create_subarray(2, groesse, teil, start, MPI_ORDER_C, MPI_UINT64_T, &_s->ansicht);
+	MPI_Type_commit(&_s->ansicht);
+	MPI_File_set_view(_s->datei, GOL_SICHERUNG_KOPF, MPI_UINT64_T, _s->ansicht, "native", info);
+#if MPI_VERSION > 3 || (MPI_VERSION == 3 && MPI_SUBVERSION >= 1)
+	MPI_File_iwrite_all(_s->datei, _s->puffer, _z_anzahl * _w_anzahl, MPI_UINT64_T, &_s->request);
+#else
+	MPI_File_write_all(_s->datei, _s->puffer, _z_anzahl * _w_anzahl, MPI_UINT64_T, MPI_STATUS_IGNORE);
+	_s->request = MPI_REQUEST_NULL;
+#endif
+	MPI_Info_free(&info);
+}
+
+void GOL_sicherung_testen(GOL_sicherung *_s) {
+	int fertig; // für MPI_Test
+	if (_s->datei != MPI_FILE_NULL) MPI_Test(&_s->request, &fertig, MPI_STATUS_IGNORE);
+}
+
+void GOL_sicherung_abschliessen(GOL_sicherung *_s) {
+	int my_rank; // eigene Prozess-ID
+	char datei[300]; // temporäre Datei
+
+	if (_s->datei == MPI_FILE_NULL) return;
+	MPI_Wait(&_s->request, MPI_STATUS_IGNORE);
+	MPI_File_close(&_s->datei);
+	MPI_Type_free(&_s->ansicht);
+	free(_s->puffer);
+	_s->puffer = NULL;
+
+	// vollständig geschrieben: temporäre Datei ersetzt die alte Sicherung
+	MPI_Comm_rank(_s->comm, &my_rank);
+	if (my_rank == ROOT) {
+		snprintf(datei, sizeof(datei), "%s.tmp", optionen.sicherung_datei);
+		if (rename(datei, optionen.sicherung_datei) != 0) printf("Error: %s kann nicht nach %s umbenannt werden\n", datei, optionen.sicherung_datei);
+		else if (optionen.ausgabe) printf("Sicherung der Runde %d in %s\n", _s->runde, optionen.sicherung_datei);
+	}
+}
+
+int GOL_sicherung_kopf(const char *_datei, int *_dim, int *_runde) {
+	long long kopf[GOL_SICHERUNG_KOPF / sizeof(long long)]; // Kopf der Datei
+	long groesse; // Dateigrösse
+	FILE *f = fopen(_datei, "rb");
+
+	if (f == NULL) {
+		printf("Error: Sicherung %s kann nicht gelesen werden\n", _datei);
+		return -1;
+	}
+	if (fread(kopf, 1, sizeof(kopf), f) != sizeof(kopf) || memcmp(kopf, "GOLSICH1", 8) != 0 || kopf[3] != GOL_worte((int) kopf[1])) {
+		printf("Error: %s ist keine Sicherung\n", _datei);
+		fclose(f);
+		return -1;
+	}
+	fseek(f, 0, SEEK_END);
+	groesse = ftell(f);
+	fclose(f);
+	if (groesse >= 0 && groesse < GOL_SICHERUNG_KOPF + kopf[1] * kopf[3] * (long long) sizeof(uint64_t)) {
+		printf("Error: Sicherung %s ist unvollständig\n", _datei);
+		return -1;
+	}
+	*_dim = (int) kopf[1];
+	*_runde = (int) kopf[2];
+	return 0;
+}
+
+int GOL_sicherung_laden(const char *_datei, MPI_Comm _comm, uint64_t **_feld, int _zeile0, int _worte, int _dim, int _z_von, int _z_anzahl,
+		int _w_von, int _w_anzahl) {
+	int groesse[2] = { _dim, GOL_worte(_dim) }, teil[2] = { _z_anzahl, _w_anzahl }, start[2] = { _z_von, _w_von }; // für die Dateiansicht
+	int fehler; // Rückgabe von MPI_File_read_all
+	MPI_File f; // Sicherungsdatei
+	MPI_Datatype ansicht, block; // eigener Block in der Datei bzw. im Spielfeld (mit Randworten)
+
+	if (MPI_File_open(_comm, (char *) _datei, MPI_MODE_RDONLY, MPI_INFO_NULL, &f) != MPI_SUCCESS) return -1;
+
+	// die Zerlegung darf anders sein als beim Schreiben: jeder Proc liest seinen jetzigen Block
+	MPI_Type_create_subarray(2, groesse, teil, start, MPI_ORDER_C, MPI_UINT64_T, &ansicht);
+	MPI_Type_vector(_z_anzahl, _w_anzahl, _worte, MPI_UINT64_T, &block);
+	MPI_Type_commit(&ansicht);
+	MPI_Type_commit(&block);
+	MPI_File_set_view(f, GOL_SICHERUNG_KOPF, MPI_UINT64_T, ansicht, "native", MPI_INFO_NULL);
+	fehler = MPI_File_read_all(f, &_feld[_zeile0][1], 1, block, MPI_STATUS_IGNORE);
+	MPI_File_close(&f);
+	MPI_Type_free(&ansicht);
+	MPI_Type_free(&block);
+	return (fehler == MPI_SUCCESS) ? 0 : -1;
+}
+
+/**
+ * Kopiert die im Sammelpuffer hintereinander liegenden Blöcke aller Procs an ihre Stelle im Vollspielfeld
+ */
+void GOL_voll_auspacken(uint64_t **_voll, const uint64_t *_sammel, int _nprocs, const int *_size, const int *_offset, const int *_nw,
+		const int *_wortoffset) {
+	int p, i; // für Schleifen
+	for (p = 0; p < _nprocs; p++) {
+		for (i = 0; i < _size[p]; i++) {
+			memcpy(&_voll[_offset[p] + 1 + i][_wortoffset[p] + 1], _sammel, _nw[p] * sizeof(uint64_t));
+			_sammel += _nw[p];
+		}
+	}
+}
+
+/**
+ * Wird das Vollspielfeld nach Runde _runde (1 ... _runden) gebraucht?
+ * -> im Demomodus, sobald der Renderthread das letzte Bild übernommen hat, alle optionen.schnappschuss Runden und
+ * nach der letzten Runde (nicht im Benchmark)
+ * (alle Procs entscheiden gleich, da optionen bei allen gleich ist und GOL_bild_frei abgestimmt wird)
+ */
+int GOL_bild_frei = 1; // Demomodus: der Renderthread hat das letzte Bild übernommen (ohne Abstimmung, z.B. Hashlife: immer)
+int GOL_voll_noetig(int _runde, int _runden) {
+	return (optionen.demo && (GOL_bild_frei || _runde == _runden)) || (optionen.schnappschuss > 0 && _runde % optionen.schnappschuss == 0)
+			|| (_runde == _runden && (optionen.ausgabe || optionen.pruefen));
+}
+
+void GOL_bild_abstimmen(MPI_Comm _comm) {
+	if (!optionen.demo) return;
+	// nur ROOT hat das Fenster; ein noch nicht gezeichnetes Bild würde ohnehin überschrieben
+	if (screen != NULL) {
+		SDL_LockMutex(anzeige.mutex);
+		GOL_bild_frei = !anzeige.neu;
+		SDL_UnlockMutex(anzeige.mutex);
+	}
+	if (_comm != MPI_COMM_NULL) MPI_Bcast(&GOL_bild_frei, 1, MPI_INT, ROOT, _comm);
+}
+
+/**
+ * Verarbeitet das Vollspielfeld nach Runde _runde (nur ROOT)
+ * - Demomodus: Bild an den Renderthread übergeben (zeichnet höchstens alle _speed Mikrosekunden)
+ * - Schnappschuss: Speichern als gol_<Runde>.pbm
+ * - letzte Runde: Anzahl der lebenden Zellen ausgeben bzw. für die Prüfung nach GOL_ergebnis kopieren
+ */
+uint64_t **GOL_ergebnis = NULL;
+void GOL_voll_ausgeben(uint64_t **_voll, int _dim, int _runde, int _runden, int _speed) {
+	char datei[64]; // Dateiname für Schnappschuss
+
+	// Ausgabe des Vollspielfelds im Demofenster (gezeichnet wird im Renderthread)
+	if (screen != NULL) GOL_gfx(_voll, _dim, _speed);
+	if (optionen.schnappschuss > 0 && _runde % optionen.schnappschuss == 0) {
+		snprintf(datei, sizeof(datei), "gol_%06d.pbm", _runde);
+		GOL_pbm_schreiben(datei, _voll, _dim);
+	}
+	if (_runde == _runden && GOL_ergebnis != NULL) {
+		memcpy(GOL_ergebnis[0], _voll[0], (size_t) (_dim + 2) * (GOL_worte(_dim) + 2) * sizeof(uint64_t));
+	} else if (_runde == _runden) {
+		printf("Lebende Zellen nach %d Runden: %lld\n", _runde, GOL_lebende(_voll, _dim, GOL_worte(_dim)));
+	}
+}
+
+/**
+ * Funktion: parallele MPI-Version von "Game Of Life"
+ * - zwei oder mehr Prozesse sind aktiv
+ *
+ * 1) Variablen Difinitionen
+ * 2) MPI Daten abfragen
+ * 3) Prozessgitter (kartesischer Kommunikator) und die acht Nachbarn bestimmen
+ * 4) eigene Spielfeldgröße bestimmen (pro Prozess eigener Block aus Zeilen und Worten)
+ * 5) Speicher für Spielfelder allozieren
+ * 6) Spielfelder initialisieren (Anfangsbedingungen)
+ * 7) Spiel runden-Mal spielen
+ * 8) Rechenzeit aller Procs zusammentragen und zurückgeben
+ *
+ * Parameter:
+ *  spielfeld_dim: Teilspielfeld X-Dimension
+ *  _runden: Anzahl derSpielrunden
+ *  _speed: Verzögerung zwischen Spielrunden
+ *  _scr_h: Bildschirmhöhe
+ *  _cell_h: Höhe der Zelle
+ *  comm: MPI Kommunikator
+ */
+double GOL_parallel(int spielfeld_dim, int _runden, MPI_Comm comm, int _speed, int _scr_h, int _cell_h) {
+	// Variablen
+	int my_rank; // eigene Prozess-ID
+	int nprocs; // Prozessanzahl
+	MPI_Comm cart; // kartesischer Kommunikator über dem Prozessgitter
+	int dims[2] = { 0, 0 }; // Prozessgitter: dims[0] Zeilen x dims[1] Spalten von Procs
+	int periods[2] = { 0, 0 }; // Ränder periodisch (Torus) bzw. nicht periodisch, ausserhalb des Spielfelds kein Leben
+	int naehen; // Torus mit angebrochenem letzten Wort: ganze Zeilen pro Proc, links und rechts lokal zusammennähen
+	int torus_rand[2] = { 0, 0 }; // naehen: Seite LINKS bzw. RECHTS rechnen, da sich die gegenüberliegende Seite geändert hat
+	int coords[2]; // eigene Position im Prozessgitter
+	int nachbar[8]; // Nachbar-Teilspielfelder, Index = Richtung (OBEN, UNTEN, ...)
+	int i, j, k, d, s; // für diverse Schleifen
+	int halo; // Tiefe der Überlappung in Zeilen = Runden pro Austausch
+	int schritte; // Runden seit dem letzten Austausch der Überlappungen
+	int z_von, z_bis, w_von, w_bis; // Rechenbereich einer Runde (Zeilen und Worte)
+	int iz_von, iz_bis, iw_von, iw_bis; // innerer Block, der ohne Überlappung berechnet werden kann
+	int worte_gesamt; // Worte pro Zeile des Vollspielfelds (ohne Randworte)
+	int max_spalten; // höchstens so viele Spalten von Procs (eine pro Wort, beim Nähen nur eine)
+	int my_size; // eigene Y_Teilspielfelddimension (Zeilen)
+	int my_offset; // Zeilen-Offset in dem Spielfeld
+	int my_nw; // eigene X-Teilspielfelddimension in Worten (64 Zellen pro Wort)
+	int my_wortoffset; // Wort-Offset in dem Spielfeld
+	int my_spalten; // eigene X-Teilspielfelddimension in Zellen
+	int my_worte; // Worte pro Zeile inkl. linkes und rechtes Randwort
+	uint64_t my_maske; // gültige Bits im letzten Wort einer Zeile
+	uint64_t rand_maske; // gültige Bits im rechten Randwort (erstes Wort des rechten Nachbarn)
+	int *all_size = NULL; // Size-Array mit my_size der einzelnen Procs
+	int *all_offset = NULL; // Offset-Array mit my_offset der einzelnen Procs
+	int *all_nw = NULL; // Array mit my_nw der einzelnen Procs
+	int *all_wortoffset = NULL; // Array mit my_wortoffset der einzelnen Procs
+	GOL_ueberlappung ueberlappung[8]; // Datentyp und Lage der Überlappung je Richtung
+	MPI_Datatype zeile_typ, spalte_typ, ecke_typ, block_typ; // abgeleitete Datentypen
+	int *sammel_anzahl = NULL, *sammel_versatz = NULL; // nur ROOT: Worte und Versatz der Blöcke im Sammelpuffer
+	uint64_t *sammel = NULL; // nur ROOT: Sammelpuffer für MPI_Igatherv, Blöcke hintereinander
+	int sammel_runde = 0; // Runde, deren Vollspielfeld gerade gesammelt wird (0 = keine)
+	MPI_Request sammel_request; // für MPI_Igatherv
+	GOL_kacheln kacheln; // aktive Kacheln im eigenen Teilspielfeld
+	int unterdruecken; // unveränderte Überlappungen nicht senden (nur bei einer Überlappungszeile)
+	int sende_anzahl[8], erhalten[8]; // gesendete bzw. empfangene Überlappungen je Richtung (0 = unverändert)
+	GOL_austausch austausch; // Spielfelder und Requests für den Austausch der Überlappungen
+	long long kachel_summe[2], kachel_proc[2]; // berechnete und geplante Kacheln aller Procs bzw. des eigenen Procs
+	uint64_t **my_spielfeld, **my_zwischen, **my_swap, **voll = NULL; // für Spielfelder
+	GOL_sicherung sicherung = GOL_SICHERUNG_LEER; // Sicherung, die im Hintergrund geschrieben wird
+	int signal_lokal[2], signal_alle[2] = { 0, 0 }; // eigene bzw. unter allen Procs abgestimmte Signale: Anzahl, beenden
+	int signal_behandelt = 0; // Anzahl der schon gesicherten Signale
+	MPI_Request signal_request = MPI_REQUEST_NULL; // für MPI_Iallreduce
+	int abbruch = 0; // Runde, nach der auf ein Signal hin beendet wurde (0 = keine)
+	int umverteilen; // Zeilen nach den Rechenzeiten umverteilen (optionen.umverteilen, mehr als eine Prozesszeile)
+	int naechste_pruefung; // Runde, ab der die Rechenzeiten wieder verglichen werden
+	int *grenzen, *neue_grenzen; // erste Zeile jeder Prozesszeile, zuletzt spielfeld_dim
+	int alt_size, alt_offset; // eigene Zeilen vor dem Umverteilen
+	double rechen_zeit = 0, rechen_start = 0; // eigene Rechenzeit (ohne Warten) seit dem letzten Vergleich
+	double *zeiten, *band_zeit, ungleich; // Rechenzeiten aller Procs bzw. Prozesszeilen, Ungleichgewicht in Prozent
+	GOL_zyklus zyklus; // Fingerabdrücke der letzten Generationen
+	double proc_zeit, max_zeit; // für Berechnung der Ausführungszeit -> Ausführungszeit jedes Prozesses und die längste Ausführungszeit
+
+	// Prozessanzahl und eigene Prozess-ID bestimmen
+	// (könnte auch über Parameter übergeben werden, aber Übersichtlichkeitshalber hier nochmal difiniert)
+	MPI_Comm_size(comm, &nprocs);
+	MPI_Comm_rank(comm, &my_rank);
+
+	/**
+	 * Torus: oben und unten sind die Nachbarn periodisch. Links und rechts nur bei ganzen Worten, sonst läge die
+	 * erste Zelle im Randwort nicht an der richtigen Bitposition; dann hat jeder Proc ganze Zeilen und setzt
+	 * die Nachbarzellen über den Rand selbst ein (nur Prozesszeilen)
+	 */
+	naehen = optionen.torus && spielfeld_dim % WORT_BITS != 0;
+	periods[0] = optionen.torus;
+	periods[1] = optionen.torus && !naehen;
+
+	/**
+	 * Prozessgitter bestimmen: möglichst quadratisch, damit die Überlappungen pro Proc mit wachsender
+	 * Prozessanzahl schrumpfen. Jede Spalte von Procs braucht mindestens ein Wort (64 Zellen) pro Zeile,
+	 * jede Zeile von Procs mindestens eine Zeile des Spielfelds; beim Nähen gibt es nur eine Spalte.
+	 */
+	worte_gesamt = GOL_worte(spielfeld_dim);
+	max_spalten = naehen ? 1 : worte_gesamt;
+	dims[1] = naehen ? 1 : 0;
+	MPI_Dims_create(nprocs, 2, dims);
+	if (dims[1] > max_spalten) {
+		for (dims[1] = max_spalten; nprocs % dims[1] != 0; dims[1]--)
+			;
+		dims[0] = nprocs / dims[1];
+	}
+	if (dims[0] > spielfeld_dim) {
+		for (dims[0] = spielfeld_dim; dims[0] > 0 && (nprocs % dims[0] != 0 || nprocs / dims[0] > max_spalten); dims[0]--)
+			;
+		if (dims[0] == 0) {
+			// gleicher Fehlerweg für den genähten Torus: dort hat jeder Proc ganze Zeilen, also höchstens spielfeld_dim Procs
+			if (my_rank == ROOT && naehen)
+				printf("Error: Torus über einem Spielfeld %d x %d (kein Vielfaches von %d Zellen) braucht ganze Zeilen pro Proc, höchstens %d Procs statt %d\n",
+						spielfeld_dim, spielfeld_dim, WORT_BITS, spielfeld_dim, nprocs);
+			else if (my_rank == ROOT)
+				printf("Error: %d Procs passen auf kein Prozessgitter über einem Spielfeld %d x %d\n", nprocs, spielfeld_dim, spielfeld_dim);
+			return -1.0;
+		}
+		dims[1] = nprocs / dims[0];
+	}
+
+	// kartesischen Kommunikator erzeugen (ohne Umnummerierung, ROOT bleibt ROOT)
+	MPI_Cart_create(comm, 2, dims, periods, 0, &cart);
+	MPI_Cart_coords(cart, my_rank, 2, coords);
+
+	// Bestimmung der Nachbar-Teilspielfelder OBEN/UNTEN und LINKS/RECHTS (MPI_PROC_NULL am Spielfeldrand)
+	MPI_Cart_shift(cart, 0, 1, &nachbar[OBEN], &nachbar[UNTEN]);
+	MPI_Cart_shift(cart, 1, 1, &nachbar[LINKS], &nachbar[RECHTS]);
+	// ... und der diagonalen Nachbarn für die Ecken der Überlappung
+	for (d = OBEN_LINKS; d <= UNTEN_LINKS; d++)
+		nachbar[d] = GOL_nachbar(cart, dims, periods, coords, d);
+
+	// eigene Y-Teilspielfeddimension und Zeilen-Offset bestimmen
+	my_size = spielfeld_dim / dims[0] + ((coords[0] < (spielfeld_dim % dims[0])) ? 1 : 0);
+	my_offset = coords[0] * (spielfeld_dim / dims[0]);
+	my_offset += (coords[0] > (spielfeld_dim % dims[0])) ? (spielfeld_dim % dims[0]) : coords[0];
+
+	// Zeilengrenzen aller Prozesszeilen (ändern sich beim Umverteilen)
+	grenzen = (int*) malloc((dims[0] + 1) * sizeof(int));
+	neue_grenzen = (int*) malloc((dims[0] + 1) * sizeof(int));
+	for (i = 0; i <= dims[0]; i++)
+		grenzen[i] = i * (spielfeld_dim / dims[0]) + ((i < spielfeld_dim % dims[0]) ? i : spielfeld_dim % dims[0]);
+	zeiten = (double*) malloc(nprocs * sizeof(double));
+	band_zeit = (double*) malloc(dims[0] * sizeof(double));
+	umverteilen = optionen.umverteilen > 0 && dims[0] > 1;
+	naechste_pruefung = optionen.start_runde + optionen.umverteilen;
+
+	// eigene X-Teilspielfeddimension in ganzen Worten und Wort-Offset bestimmen
+	my_nw = worte_gesamt / dims[1] + ((coords[1] < (worte_gesamt % dims[1])) ? 1 : 0);
+	my_wortoffset = coords[1] * (worte_gesamt / dims[1]);
+	my_wortoffset += (coords[1] > (worte_gesamt % dims[1])) ? (worte_gesamt % dims[1]) : coords[1];
+
+	// nur die rechte Spalte von Procs hat ein angebrochenes letztes Wort
+	my_spalten = (coords[1] == dims[1] - 1) ? spielfeld_dim - my_wortoffset * WORT_BITS : my_nw * WORT_BITS;
+	my_maske = GOL_maske(my_spalten);
+	my_worte = my_nw + 2;
+	rand_maske = (my_wortoffset + my_nw == worte_gesamt - 1) ? GOL_maske(spielfeld_dim) : ~(uint64_t) 0;
+
+	/**
+	 * Tiefe der Überlappung: halo Randzeilen werden auf einmal ausgetauscht, danach werden halo Runden
+	 * lokal auf einem schrumpfenden gültigen Bereich gerechnet (Rechnen statt Kommunizieren).
+	 * Begrenzt durch die kleinste Zeilenzahl eines Procs (Randzeilen kommen nur vom direkten Nachbarn)
+	 * und durch die 64 Zellen eines Randwortes.
+	 */
+	halo = optionen.halo;
+	if (halo > spielfeld_dim / dims[0]) halo = spielfeld_dim / dims[0];
+	if (halo > WORT_BITS) halo = WORT_BITS;
+	if (halo < 1) halo = 1;
+
+	// NUR ROOT: alloziere dynamischen Speicehr für all_offset etc.
+	if (my_rank == ROOT) {
+		if (optionen.ausgabe) printf("Prozessgitter: %d x %d, Überlappung: %d Zeilen\n", dims[0], dims[1], halo);
+		all_size = (int*) malloc(nprocs * sizeof(int));
+		all_offset = (int*) malloc(nprocs * sizeof(int));
+		all_nw = (int*) malloc(nprocs * sizeof(int));
+		all_wortoffset = (int*) malloc(nprocs * sizeof(int));
+	}
+
+	// Zusammentragen im ROOT-Proc der berechneten Werte für my_size, my_offset, my_nw und my_wortoffset
+	MPI_Gather(&my_size, 1, MPI_INT, all_size, 1, MPI_INT, ROOT, cart);
+	MPI_Gather(&my_offset, 1, MPI_INT, all_offset, 1, MPI_INT, ROOT, cart);
+	MPI_Gather(&my_nw, 1, MPI_INT, all_nw, 1, MPI_INT, ROOT, cart);
+	MPI_Gather(&my_wortoffset, 1, MPI_INT, all_wortoffset, 1, MPI_INT, ROOT, cart);
+
+	/** FEHLERSUCHE
+	 if (my_rank == ROOT) {
+	 for (i = 0; i < nprocs; i++)
+	 printf("all_size[%d] = %d // all_offset[%d] = %d // all_nw[%d] = %d // all_wortoffset[%d] = %d\n", i, all_size[i], i, all_offset[i], i,
+	 all_nw[i], i, all_wortoffset[i]);
+	 }
+	 */
+
+	// alloziere dynamischen Speicher für Teilspielfelder (jeder Proc für sich)
+	// eigene Zeilen: halo ... halo + my_size - 1, darüber und darunter je halo Randzeilen
+	// beim Umverteilen ändern die Spielfelder ihre Größe, dann ohne gemeinsames Fenster
+	GOL_austausch_felder(&austausch, cart, my_size + 2 * halo, my_worte, !umverteilen);
+	my_spielfeld = austausch.feld[0];
+	my_zwischen = austausch.feld[1];
+
+	// NUR ROOT: alloziere dynamischen Speicher für Vollspielfeld (mit oberer und unterer NULL-Zeile wie im seriellen Spielfeld)
+	if (my_rank == ROOT) {
+		voll = malloc2D_bits(spielfeld_dim + 2, worte_gesamt + 2);
+	}
+
+	/** FEHLERSUCHE
+	 // jeder Proc gibt seinen allozierten Speicher aus
+	 printf("Proc %d / my_spielfeld @ %p (%ld Byte) / zwischen @ %p (%ld Byte) / voll @ %p (%ld Byte)\n", my_rank, (void *) my_spielfeld,
+	 (long) (my_size + 2 * halo) * my_worte * (long) sizeof(uint64_t), (void *) my_zwischen,
+	 (long) (my_size + 2 * halo) * my_worte * (long) sizeof(uint64_t), (void *) voll,
+	 (voll != NULL ? (long) (spielfeld_dim + 2) * (worte_gesamt + 2) * (long) sizeof(uint64_t) : 0L));
+	 */
+
+	/**
+	 * abgeleitete Datentypen für die Überlappungen
+	 * zeile_typ: eigene Worte von halo Zeilen (ohne Randworte)
+	 * spalte_typ: je ein Wort aus jeder eigenen Zeile (Spalte mit Abstand my_worte), ein Wort enthält 64 Randspalten
+	 * ecke_typ: je ein Wort aus halo Zeilen
+	 * block_typ: eigenes Teilspielfeld ohne Überlappungen, für das Zusammentragen bei ROOT
+	 */
+	MPI_Type_vector(halo, my_nw, my_worte, MPI_UINT64_T, &zeile_typ);
+	MPI_Type_vector(my_size, 1, my_worte, MPI_UINT64_T, &spalte_typ);
+	MPI_Type_vector(halo, 1, my_worte, MPI_UINT64_T, &ecke_typ);
+	MPI_Type_vector(my_size, my_nw, my_worte, MPI_UINT64_T, &block_typ);
+	MPI_Type_commit(&zeile_typ);
+	MPI_Type_commit(&spalte_typ);
+	MPI_Type_commit(&ecke_typ);
+	MPI_Type_commit(&block_typ);
+
+	// Lage der Überlappungen je Richtung
+	GOL_ueberlappung_setzen(ueberlappung, zeile_typ, spalte_typ, ecke_typ, halo, my_size, my_nw);
+	GOL_austausch_anlegen(&austausch, cart, nachbar, ueberlappung, halo, my_size, my_nw);
+
+	/**
+	 * Kacheln über den eigenen Zeilen und Worten
+	 * Bei einer Überlappungszeile wird ein Rand, der gleich dem von vor zwei Runden ist, als leere Nachricht
+	 * gesendet: beim Empfänger steht die Überlappung von vor zwei Runden noch im selben Spielfeld (Randzeilen
+	 * werden dann nicht berechnet), es muss nichts kopiert werden.
+	 * Bei tiefer Überlappung werden die Randzeilen lokal weitergerechnet, die Kacheln am Rand zu einem Nachbarn
+	 * werden dann immer berechnet.
+	 */
+	GOL_kacheln_anlegen(&kacheln, halo, my_size, my_nw, my_offset, my_wortoffset);
+	unterdruecken = optionen.kacheln && halo == 1;
+
+	// NUR ROOT: Sammelpuffer, in dem die Blöcke aller Procs hintereinander ankommen
+	if (my_rank == ROOT) {
+		sammel_anzahl = (int*) malloc(nprocs * sizeof(int));
+		sammel_versatz = (int*) malloc(nprocs * sizeof(int));
+		for (i = 0; i < nprocs; i++) {
+			sammel_anzahl[i] = all_size[i] * all_nw[i];
+			sammel_versatz[i] = (i == 0) ? 0 : sammel_versatz[i - 1] + sammel_anzahl[i - 1];
+		}
+		sammel = (uint64_t *) malloc((size_t) (sammel_versatz[nprocs - 1] + sammel_anzahl[nprocs - 1]) * sizeof(uint64_t));
+	}
+
+	// der Aussenrand ist durch GOL_austausch_felder mit Nullen initialisiert, entspricht kein Leben ausserhalb des Spielfelds
+
+	// Initialisierung des Spielfelds mit Werten, entspricht Anfangsbedingungen: Sicherung, Musterdatei (eigene Zeilen) oder Zufallswerte
+	if (optionen.fortsetzen[0] != '\0') {
+		if (GOL_sicherung_laden(optionen.fortsetzen, cart, my_spielfeld, halo, my_worte, spielfeld_dim, my_offset, my_size, my_wortoffset, my_nw) != 0
+				&& my_rank == ROOT)
+			printf("Error: Sicherung %s kann nicht gelesen werden\n", optionen.fortsetzen);
+	} else if (optionen.muster[0] == '\0'
+			|| GOL_muster_laden(optionen.muster, cart, spielfeld_dim, my_spielfeld, halo, my_offset, my_size, my_wortoffset * WORT_BITS, my_spalten) != 0) {
+		// Zufallswerte: nur von der Saat und der Lage im Spielfeld abhängig, gleich für jede Aufteilung
+		GOL_zufall_fuellen(my_spielfeld, my_zwischen, halo, my_size, my_nw, my_spalten, my_offset, my_wortoffset);
+	}
+
+	// Zykluserkennung: Fingerabdruck der Anfangsgeneration, danach führen ihn die Kacheln nach
+	GOL_zyklus_anlegen(&zyklus);
+	if (optionen.zyklus > 0) kacheln.hash = GOL_kacheln_hash(&kacheln, my_spielfeld, halo, halo + my_size, 1, my_nw + 1);
+	GOL_zyklus_merken(&zyklus, cart, optionen.start_runde, kacheln.hash, 0);
+
+	// Startzeit speichern (jeder Proc für sich)
+	GOL_profil_start(cart);
 	proc_zeit = MPI_Wtime();
 
-	// Spiel "_runden-Mal" spielen
-	for (k = 0; k < _runden; k++) {
-		// Sende und empfange Überlappung OBEN
-		MPI_Isend(&my_spielfeld[1][0], spielfeld_dim + 2, MPI_INT, sende_oben, 0, MPI_COMM_WORLD, request);
-		MPI_Irecv(&my_spielfeld[0][0], spielfeld_dim + 2, MPI_INT, hole_oben, 0, MPI_COMM_WORLD, request + 1);
-
-		// Sende und empfange Überlappung UNTEN
-		MPI_Isend(&my_spielfeld[my_size][0], spielfeld_dim + 2, MPI_INT, sende_unten, 0, MPI_COMM_WORLD, request + 2);
-		MPI_Irecv(&my_spielfeld[my_size + 1][0], spielfeld_dim + 2, MPI_INT, hole_unten, 0, MPI_COMM_WORLD, request + 3);
-
-		// Warte auf Abschluss von Isend/Irecv
-		MPI_Waitall(4, request, status);
-
-		/** FEHLERSUCHE
-		 // Teilspielfelder mit der empfangenen Überlappungen ausgeben
-		 printf("Anfangsfeld von %d:\n", my_rank);
-		 for (i = 0; i < my_size + 2; i++) {
-		 for (j = 0; j < matrix_size + 2; j++) {
-		 printf("%d ", my_spielfeld[i][j]);
-		 }
-		 printf("\n");
-		 }
+	// Spiel "_runden-Mal" spielen, je Austausch der Überlappungen bis zu halo Runden
+	for (k = optionen.start_runde; k < _runden; k += schritte) {
+		schritte = (_runden - k < halo) ? _runden - k : halo;
+		if (optionen.sicherung > 0 && schritte > optionen.sicherung - k % optionen.sicherung)
+			schritte = optionen.sicherung - k % optionen.sicherung; // Austausch fällt auf jede zu sichernde Runde
+		GOL_PHASE(GOL_P_AUSTAUSCH, k + 1);
+
+		/**
+		 * Sende und empfange die Überlappungen in alle acht Richtungen
+		 * Tag = Richtung, in die gesendet wird; empfangen wird aus der Gegenrichtung (d ^ 1)
+		 * ist der eigene Rand gleich dem von vor zwei Runden, geht nur eine leere Nachricht
+		 * Nachbarn im gemeinsamen Fenster lesen den Rand selbst; die Quittung des vorigen Austauschs muss da sein,
+		 * bevor die übernächste Generation in dessen Spielfeld geschrieben wird
 		 */
+		GOL_austausch_quittung(&austausch);
+		for (d = 0; d < 8; d++)
+			sende_anzahl[d] = !unterdruecken || GOL_kacheln_seite_geaendert(&kacheln, d);
+		GOL_austausch_starten(&austausch, my_spielfeld, sende_anzahl);
+
+		for (s = 1; s <= schritte; s++) {
+			/**
+			 * Rechenbereich dieser Runde: eigener Block, auf Seiten mit Nachbarn zusätzlich die Randzeilen und das Randwort,
+			 * die bis zum nächsten Austausch noch gebraucht werden (der gültige Bereich schrumpft pro Runde um eine Zelle)
+			 * am Spielfeldrand bleiben Randzeilen und Randworte tot
+			 */
+			z_von = halo - ((nachbar[OBEN] != MPI_PROC_NULL) ? schritte - s : 0);
+			z_bis = halo + my_size + ((nachbar[UNTEN] != MPI_PROC_NULL) ? schritte - s : 0);
+			w_von = (nachbar[LINKS] != MPI_PROC_NULL && s < schritte) ? 0 : 1;
+			w_bis = (nachbar[RECHTS] != MPI_PROC_NULL && s < schritte) ? my_nw + 2 : my_nw + 1;
+			GOL_PHASE(GOL_P_RECHNEN, k + s);
+			rechen_start = MPI_Wtime();
+
+			// Kacheln mit Änderungen in der Nachbarschaft; bei tiefer Überlappung auch alle Kacheln am Rand zu einem Nachbarn
+			// (naehen: an der Seite, deren gegenüberliegende Seite sich geändert hat)
+			if (naehen) {
+				torus_rand[0] = GOL_kacheln_seite_geaendert(&kacheln, RECHTS);
+				torus_rand[1] = GOL_kacheln_seite_geaendert(&kacheln, LINKS);
+			}
+			GOL_kacheln_planen(&kacheln);
+			if (halo > 1) {
+				for (d = 0; d < 8; d++)
+					if (nachbar[d] != MPI_PROC_NULL) GOL_kacheln_rand(&kacheln, d);
+			}
+			if (naehen) {
+				if (torus_rand[0]) GOL_kacheln_rand(&kacheln, LINKS);
+				if (torus_rand[1]) GOL_kacheln_rand(&kacheln, RECHTS);
+			}
+
+			if (s == 1) {
+				// während die Überlappungen unterwegs sind: innerer Block (ohne die äusseren eigenen Zeilen und Worte) berechnen,
+				// er braucht keine Überlappung (nächste Generation mit dem Bit-Addierwerk, 64 Zellen pro Wort; jeder Proc für sich)
+				iz_von = halo + 1;
+				iz_bis = (halo + my_size - 1 > iz_von) ? halo + my_size - 1 : iz_von;
+				iw_von = 2;
+				iw_bis = (my_nw > 2) ? my_nw : 2;
+				GOL_PHASE(GOL_P_INNEN, k + s);
+				GOL_kacheln_block(&kacheln, my_spielfeld, my_zwischen, iz_von, iz_bis, iw_von, iw_bis, my_worte, my_maske, rand_maske);
+
+				// Warte auf Abschluss von Isend/Irecv
+				GOL_PHASE(GOL_P_WARTEN, k + s);
+				rechen_zeit += MPI_Wtime() - rechen_start;
+				GOL_austausch_beenden(&austausch, my_spielfeld, ueberlappung, erhalten);
+				rechen_start = MPI_Wtime();
+				GOL_PHASE(GOL_P_RECHNEN, k + s);
+
+				// naehen: erst jetzt, die eigenen Randzeilen waren bis eben Sendepuffer (bzw. werden im Fenster gelesen)
+				if (naehen) {
+					GOL_austausch_quittung(&austausch);
+					GOL_torus_naehen(my_spielfeld, z_von - 1, z_bis + 1, my_nw, my_spalten);
+				}
+
+				// geänderte Überlappung (keine leere Nachricht): Kacheln an dieser Seite rechnen
+				// (der innere Block ist schon gerechnet, eine Überlappungszeile betrifft nur die äussere Zellreihe)
+				if (unterdruecken) {
+					for (d = 0; d < 8; d++)
+						if (erhalten[d]) GOL_kacheln_rand(&kacheln, d);
+				} else if (halo == 1) {
+					for (d = 0; d < 8; d++)
+						if (nachbar[d] != MPI_PROC_NULL) GOL_kacheln_rand(&kacheln, d);
+				}
+
+				/** FEHLERSUCHE
+				 // Teilspielfelder mit der empfangenen Überlappungen ausgeben
+				 printf("Anfangsfeld von %d:\n", my_rank);
+				 for (i = 0; i < my_size + 2 * halo; i++) {
+				 for (j = 1; j <= my_spalten; j++) {
+				 printf("%d ", (int) ZELLE(my_spielfeld[i], j));
+				 }
+				 printf("\n");
+				 }
+				 */
+
+				// Rest des Rechenbereichs (Streifen oben, unten, links und rechts) mit den empfangenen Überlappungen berechnen
+				GOL_kacheln_block(&kacheln, my_spielfeld, my_zwischen, z_von, iz_von, w_von, w_bis, my_worte, my_maske, rand_maske);
+				GOL_kacheln_block(&kacheln, my_spielfeld, my_zwischen, iz_bis, z_bis, w_von, w_bis, my_worte, my_maske, rand_maske);
+				GOL_kacheln_block(&kacheln, my_spielfeld, my_zwischen, iz_von, iz_bis, w_von, iw_von, my_worte, my_maske, rand_maske);
+				GOL_kacheln_block(&kacheln, my_spielfeld, my_zwischen, iz_von, iz_bis, iw_bis, w_bis, my_worte, my_maske, rand_maske);
+			} else {
+				// weitere Runden ohne Austausch auf den noch gültigen Randzeilen; ab der zweiten wird in das Spielfeld
+				// geschrieben, aus dem die Nachbarn beim Austausch gelesen haben
+				if (s == 2) GOL_austausch_quittung(&austausch);
+				if (naehen) GOL_torus_naehen(my_spielfeld, z_von - 1, z_bis + 1, my_nw, my_spalten);
+				GOL_kacheln_block(&kacheln, my_spielfeld, my_zwischen, z_von, z_bis, w_von, w_bis, my_worte, my_maske, rand_maske);
+			}
+			if (naehen) GOL_torus_trennen(my_spielfeld, z_von - 1, z_bis + 1, my_nw, my_maske);
+			rechen_zeit += MPI_Wtime() - rechen_start;
 
-		// Nachbarnanzahl in 8-ter Nachbarnschaft bestimen (jeder Proc für sich)
-		for (i = 1; i <= my_size; i++) {
-			for (j = 1; j < spielfeld_dim + 1; j++) {
-				// Summe über alle Nachbarn bilden
-				nachbarn = my_spielfeld[i - 1][j - 1] + my_spielfeld[i - 1][j] + my_spielfeld[i - 1][j + 1] + my_spielfeld[i][j - 1] + my_spielfeld[i][j + 1]
-						+ my_spielfeld[i + 1][j - 1] + my_spielfeld[i + 1][j] + my_spielfeld[i + 1][j + 1];
-
-				// leben, sterben, neues Leben ?
-				if (nachbarn < 2 || nachbarn > 3) { // 0, 1, 4, 5, ...
-					my_zwischen[i][j] = 0; // sterben
-				} else if (nachbarn == 3) { // 3
-					my_zwischen[i][j] = 1; // weiter leben bzw. neues Leben
-				} else { // 2
-					my_zwischen[i][j] = my_spielfeld[i][j]; // alten Wert übernehmen
+			// das Sammeln der Vorrunde lief parallel zu dieser Runde, spätestens jetzt abschließen:
+			// nach der Umadressierung wird in diese Spielfeld-Adresse wieder geschrieben
+			if (sammel_runde > 0) {
+				GOL_PHASE(GOL_P_SAMMELN, k + s);
+				MPI_Wait(&sammel_request, MPI_STATUS_IGNORE);
+				if (my_rank == ROOT) {
+					GOL_PHASE(GOL_P_AUSGABE, k + s);
+					GOL_voll_auspacken(voll, sammel, nprocs, all_size, all_offset, all_nw, all_wortoffset);
+					GOL_voll_ausgeben(voll, spielfeld_dim, sammel_runde, _runden, _speed);
 				}
+				sammel_runde = 0;
+			}
+
+			// Umadressierung der Spielfelder
+			my_swap = my_spielfeld; // Anfangsspielfeld -> Adresse in my_swap speichern
+			my_spielfeld = my_zwischen; // Zwischenergebnis -> wird Endergebnis der aktuellen Spielrunde
+			my_zwischen = my_swap; // Zwischenergebnis -> wird Anfangsspielfeld für die nächste Runde
+
+			// Zykluserkennung: auf Wunsch ist diese Runde die letzte (alle Procs entscheiden gleich)
+			if (optionen.zyklus > 0) {
+				GOL_PHASE(GOL_P_ZYKLUS, k + s);
+				if (GOL_zyklus_merken(&zyklus, cart, k + s, kacheln.hash, k + s == _runden) && optionen.zyklus_ende) {
+					_runden = k + s;
+					schritte = s;
+				}
+			}
+
+			/**
+			 * Sende und empfange VOLL, aber nur wenn es gebraucht wird (Demomodus, Schnappschuss, letzte Runde)
+			 * alle Blöcke gehen per MPI_Igatherv an ROOT; die Überlappungen werden nicht gesendet,
+			 * das Sammeln läuft parallel zur nächsten Runde (die das Spielfeld nur liest); im Demomodus nur, wenn
+			 * der Renderthread das letzte Bild schon übernommen hat
+			 */
+			GOL_bild_abstimmen(cart);
+			if (GOL_voll_noetig(k + s, _runden)) {
+				GOL_PHASE(GOL_P_SAMMELN, k + s);
+#if MPI_VERSION >= 3
+				if (!naehen) {
+					MPI_Igatherv(&my_spielfeld[halo][1], 1, block_typ, sammel, sammel_anzahl, sammel_versatz, MPI_UINT64_T, ROOT, cart,
+							&sammel_request);
+				} else
+#endif
+				{
+					// naehen: die nächste Runde schreibt in die Auffüllbits des Sendepuffers, also gleich fertig sammeln
+					MPI_Gatherv(&my_spielfeld[halo][1], 1, block_typ, sammel, sammel_anzahl, sammel_versatz, MPI_UINT64_T, ROOT, cart);
+					sammel_request = MPI_REQUEST_NULL;
+				}
+				sammel_runde = k + s;
 			}
 		}
 
-		// Umadressierung der Spielfelder
-		my_swap = my_spielfeld; // Anfangsspielfeld -> Adresse in my_swap speichern
-		my_spielfeld = my_zwischen; // Zwischenergebnis -> wird Endergebnis der aktuellen Spielrunde
-		my_zwischen = my_swap; // Zwischenergebnis -> wird Anfangsspielfeld für die nächste Runde
+		/**
+		 * Umverteilung nach einem Austausch-Zyklus: alle optionen.umverteilen Runden die Rechenzeiten vergleichen
+		 * (ohne Warten auf Überlappungen, das ist ja gerade die Folge des Ungleichgewichts). Eine Prozesszeile ist so
+		 * langsam wie ihr langsamster Proc; ist sie deutlich langsamer als das Mittel, wandern Zeilen an den Grenzen
+		 * zu den Nachbarn (alle Procs einer Prozesszeile gleich, links und rechts bleiben die Zeilen also gleich).
+		 * Nicht während ein Vollspielfeld gesammelt wird (Blockgrößen bei ROOT) und nicht nach der letzten Runde.
+		 * Danach sind alle Kacheln wieder "geändert" und die Überlappungen gehen vollständig, bis die Nachbarschaft
+		 * von vor zwei Runden wieder in den neuen Spielfeldern steht.
+		 */
+		if (umverteilen && k + schritte >= naechste_pruefung && k + schritte < _runden && sammel_runde == 0) {
+			GOL_PHASE(GOL_P_UMVERTEILEN, k + schritte);
+			naechste_pruefung = k + schritte + optionen.umverteilen;
+			MPI_Allgather(&rechen_zeit, 1, MPI_DOUBLE, zeiten, 1, MPI_DOUBLE, cart);
+			rechen_zeit = 0;
+
+			// Ränge liegen zeilenweise im Prozessgitter (ohne Umnummerierung)
+			for (i = 0; i < dims[0]; i++) {
+				band_zeit[i] = 0;
+				for (j = 0; j < dims[1]; j++)
+					if (zeiten[i * dims[1] + j] > band_zeit[i]) band_zeit[i] = zeiten[i * dims[1] + j];
+			}
+
+			if (GOL_grenzen_ausgleichen(band_zeit, grenzen, neue_grenzen, dims[0], halo, &ungleich)) {
+				alt_size = my_size;
+				alt_offset = my_offset;
+				my_offset = neue_grenzen[coords[0]];
+				my_size = neue_grenzen[coords[0] + 1] - my_offset;
+				memcpy(grenzen, neue_grenzen, (dims[0] + 1) * sizeof(int));
+
+				// Zeilen umziehen; das Zwischenspielfeld wird in der nächsten Runde ganz neu berechnet
+				GOL_austausch_freigeben(&austausch);
+				my_spielfeld = GOL_zeilen_umziehen(my_spielfeld, cart, nachbar[OBEN], nachbar[UNTEN], halo, my_worte, alt_offset, alt_size,
+						my_offset, my_size);
+				free2D_bits(my_zwischen);
+				my_zwischen = malloc2D_bits(my_size + 2 * halo, my_worte);
+
+				// Datentypen und Überlappungen hängen von my_size ab
+				MPI_Type_free(&spalte_typ);
+				MPI_Type_free(&block_typ);
+				MPI_Type_vector(my_size, 1, my_worte, MPI_UINT64_T, &spalte_typ);
+				MPI_Type_vector(my_size, my_nw, my_worte, MPI_UINT64_T, &block_typ);
+				MPI_Type_commit(&spalte_typ);
+				MPI_Type_commit(&block_typ);
+				GOL_ueberlappung_setzen(ueberlappung, zeile_typ, spalte_typ, ecke_typ, halo, my_size, my_nw);
+				austausch.feld[0] = my_spielfeld;
+				austausch.feld[1] = my_zwischen;
+				GOL_austausch_anlegen(&austausch, cart, nachbar, ueberlappung, halo, my_size, my_nw);
 
-		// Sende und empfange VOLL
-		MPI_Status statusRecv;
+				// Kacheln neu anlegen (alle geändert), die Statistik läuft weiter
+				kachel_proc[0] = kacheln.gerechnet;
+				kachel_proc[1] = kacheln.gesamt;
+				GOL_kacheln_freigeben(&kacheln);
+				GOL_kacheln_anlegen(&kacheln, halo, my_size, my_nw, my_offset, my_wortoffset);
+				kacheln.gerechnet = kachel_proc[0];
+				kacheln.gesamt = kachel_proc[1];
+				if (optionen.zyklus > 0) kacheln.hash = GOL_kacheln_hash(&kacheln, my_spielfeld, halo, halo + my_size, 1, my_nw + 1);
+
+				// ROOT: neue Blockgrößen für das Sammeln
+				MPI_Gather(&my_size, 1, MPI_INT, all_size, 1, MPI_INT, ROOT, cart);
+				MPI_Gather(&my_offset, 1, MPI_INT, all_offset, 1, MPI_INT, ROOT, cart);
+				if (my_rank == ROOT) {
+					for (i = 0; i < nprocs; i++) {
+						sammel_anzahl[i] = all_size[i] * all_nw[i];
+						sammel_versatz[i] = (i == 0) ? 0 : sammel_versatz[i - 1] + sammel_anzahl[i - 1];
+					}
+					if (optionen.ausgabe) {
+						printf("Umverteilung nach Runde %d (Ungleichgewicht %.0f %%), Zeilen je Prozesszeile:", k + schritte, ungleich);
+						for (i = 0; i < dims[0]; i++)
+							printf(" %d", grenzen[i + 1] - grenzen[i]);
+						printf("\n");
+					}
+				}
+			}
+		}
 
 		/**
-		 * Proc ROOT empfängt die Teilspielfelder
-		 * die Seitlichen NULL-Zeilen werden mitgesendet bzw. empfangen
-		 * Überlappungen sowie obere und untere NULL-Zeilen werden nicht gesendet/empfangen
+		 * Sicherung nach jedem Austausch-Zyklus: regelmäßig oder auf ein Signal. Signale kommen nicht bei allen Procs
+		 * gleichzeitig an; die Abstimmung (MPI_Iallreduce) läuft während des folgenden Zyklus und gilt beim nächsten.
+		 * Gezählt wird die höchste Signalanzahl eines Procs, so löst ein Signal an alle Procs nur eine Sicherung aus.
 		 */
+		if (optionen.sicherung != 0) {
+			GOL_PHASE(GOL_P_SICHERN, k + schritte);
+			if (signal_request != MPI_REQUEST_NULL) MPI_Wait(&signal_request, MPI_STATUS_IGNORE);
+			if (signal_alle[0] > signal_behandelt || GOL_sicherung_faellig(k + schritte)) {
+				GOL_sicherung_schreiben(&sicherung, cart, my_spielfeld, halo, spielfeld_dim, my_offset, my_size, my_wortoffset, my_nw, k + schritte);
+			} else {
+				GOL_sicherung_testen(&sicherung);
+			}
+			signal_behandelt = signal_alle[0];
+			if (signal_alle[1]) {
+				abbruch = k + schritte;
+				break;
+			}
+			signal_lokal[0] = GOL_signal;
+			signal_lokal[1] = GOL_signal_ende;
+#if MPI_VERSION >= 3
+			MPI_Iallreduce(signal_lokal, signal_alle, 2, MPI_INT, MPI_MAX, cart, &signal_request);
+#else
+			MPI_Allreduce(signal_lokal, signal_alle, 2, MPI_INT, MPI_MAX, cart);
+#endif
+		}
+	}
+	if (signal_request != MPI_REQUEST_NULL) MPI_Wait(&signal_request, MPI_STATUS_IGNORE);
+	GOL_PHASE(GOL_P_SICHERN, _runden);
+	GOL_sicherung_abschliessen(&sicherung);
+	if (abbruch > 0 && my_rank == ROOT) printf("Auf Signal nach Runde %d beendet, fortsetzen mit -fortsetzen %s\n", abbruch, optionen.sicherung_datei);
+
+	// letztes Sammeln abschließen (Ergebnis der letzten Runde)
+	if (sammel_runde > 0) {
+		GOL_PHASE(GOL_P_SAMMELN, _runden);
+		MPI_Wait(&sammel_request, MPI_STATUS_IGNORE);
 		if (my_rank == ROOT) {
-			for (i = 1; i < nprocs; i++) {
-				MPI_Recv(&voll[all_offset[i]][0], all_elements[i], MPI_INT, i, 99, MPI_COMM_WORLD, &statusRecv);
+			GOL_PHASE(GOL_P_AUSGABE, _runden);
+			GOL_voll_auspacken(voll, sammel, nprocs, all_size, all_offset, all_nw, all_wortoffset);
+			GOL_voll_ausgeben(voll, spielfeld_dim, sammel_runde, _runden, _speed);
+		}
+	}
+
+	// Rechnezeit berechnen und in proc_zeit speichern (jeder Proc für sich)
+	proc_zeit = MPI_Wtime() - proc_zeit;
+	GOL_profil_ende(cart);
+
+	// Anteil der berechneten Kacheln über alle Procs
+	if (optionen.kacheln) {
+		kachel_proc[0] = kacheln.gerechnet;
+		kachel_proc[1] = kacheln.gesamt;
+		MPI_Reduce(kachel_proc, kachel_summe, 2, MPI_LONG_LONG, MPI_SUM, ROOT, cart);
+		if (my_rank == ROOT && optionen.ausgabe && kachel_summe[1] > 0)
+			printf("Berechnete Kacheln: %.1f %%\n", 100.0 * kachel_summe[0] / kachel_summe[1]);
+	}
+
+	// Speicher und Datentypen freigeben
+	GOL_kacheln_freigeben(&kacheln);
+	GOL_zyklus_freigeben(&zyklus);
+	GOL_austausch_freigeben(&austausch);
+	GOL_austausch_felder_freigeben(&austausch);
+	free2D_bits(voll);
+	free(grenzen);
+	free(neue_grenzen);
+	free(zeiten);
+	free(band_zeit);
+	MPI_Type_free(&zeile_typ);
+	MPI_Type_free(&spalte_typ);
+	MPI_Type_free(&ecke_typ);
+	MPI_Type_free(&block_typ);
+	if (my_rank == ROOT) {
+		free(sammel);
+		free(sammel_anzahl);
+		free(sammel_versatz);
+		free(all_size);
+		free(all_offset);
+		free(all_nw);
+		free(all_wortoffset);
+	}
+
+	// Die maximale Rechenzeite bestimmen und beim Proc 0 in max_zeit speichern
+	MPI_Reduce(&proc_zeit, &max_zeit, 1, MPI_DOUBLE, MPI_MAX, ROOT, cart);
+	MPI_Comm_free(&cart);
+
+	// längste Rechenzeit zurückgeben
+	return (max_zeit);
+}
+
+/**
+ * Benchmark: Skalierungsmessung (alle Procs)
+ *
+ * Je Messpunkt (Art, Dimension, Runden, Prozessanzahl p) rechnen die ersten p Procs auf einem eigenen
+ * Kommunikator erst optionen.bench_aufwaermen ungemessene, dann optionen.bench_wdh gemessene Läufe mit
+ * GOL_parallel. Starke Skalierung: gleiche Dimension für alle p; schwache Skalierung: gleiche Fläche pro Proc,
+ * Dimension = bench_dim * Wurzel(p). ROOT schreibt pro Messpunkt eine CSV-Zeile mit Minimum, Median und
+ * Maximum der Laufzeit (jeweils der langsamste Proc) und den Zellen pro Sekunde und Proc (aus dem Median).
+ */
+void GOL_benchmark(MPI_Comm _comm, int _threads) {
+	int my_rank, nprocs; // eigene Prozess-ID und Prozessanzahl
+	int procs[32], n_procs = 0; // Prozessanzahlen der Messreihe: 1, 2, 4, ..., nprocs
+	int art, d, r, n, w, i; // für Schleifen
+	int dim; // Dimension des Messpunkts
+	long long flaeche; // Zielfläche bei schwacher Skalierung
+	double *zeiten, zeit; // gemessene Laufzeiten
+	static const int std_dims[3] = { 1000, 2000, 4000 }; // Standard-Dimensionen
+	static const int std_runden[1] = { 100 }; // Standard-Rundenanzahl
+	const int *dims = optionen.bench_n_dims > 0 ? optionen.bench_dims : std_dims;
+	const int *runden = optionen.bench_n_runden > 0 ? optionen.bench_runden : std_runden;
+	int n_dims = optionen.bench_n_dims > 0 ? optionen.bench_n_dims : 3;
+	int n_runden = optionen.bench_n_runden > 0 ? optionen.bench_n_runden : 1;
+	MPI_Comm teil; // Kommunikator der ersten p Procs
+	FILE *aus = stdout; // Ziel der CSV-Zeilen
+
+	MPI_Comm_rank(_comm, &my_rank);
+	MPI_Comm_size(_comm, &nprocs);
+	for (n = 1; n < nprocs; n *= 2)
+		procs[n_procs++] = n;
+	procs[n_procs++] = nprocs;
+	zeiten = (double *) malloc(optionen.bench_wdh * sizeof(double));
+
+	if (my_rank == ROOT) {
+		if (optionen.bench_datei[0] != '\0' && (aus = fopen(optionen.bench_datei, "w")) == NULL) {
+			printf("Error: %s kann nicht geschrieben werden, Ergebnisse auf der Standardausgabe\n", optionen.bench_datei);
+			aus = stdout;
+		}
+		if (optionen.benchmark & GOL_KERNEL) GOL_kernel_messen(aus);
+		if (optionen.benchmark & (GOL_STARK | GOL_SCHWACH))
+			fprintf(aus, "art,procs,threads,kernel,dim,runden,wiederholungen,min_s,median_s,max_s,zellen_pro_s_pro_proc\n");
+		fflush(aus);
+	}
+
+	for (art = GOL_STARK; art <= GOL_SCHWACH; art <<= 1) {
+		if (!(optionen.benchmark & art)) continue;
+		for (d = 0; d < n_dims; d++) {
+			for (r = 0; r < n_runden; r++) {
+				for (n = 0; n < n_procs; n++) {
+					// Dimension des Messpunkts (schwach: ganzzahlige Wurzel der Zielfläche)
+					dim = dims[d];
+					if (art == GOL_SCHWACH) {
+						flaeche = (long long) dims[d] * dims[d] * procs[n];
+						while ((long long) (dim + 1) * (dim + 1) <= flaeche)
+							dim++;
+					}
+
+					// die ersten procs[n] Procs rechnen, die übrigen warten an der Barriere
+					zeit = 0;
+					MPI_Comm_split(_comm, (my_rank < procs[n]) ? 0 : MPI_UNDEFINED, my_rank, &teil);
+					if (teil != MPI_COMM_NULL) {
+						for (w = 0; w < optionen.bench_aufwaermen + optionen.bench_wdh; w++) {
+							zeit = GOL_parallel(dim, runden[r], teil, 0, 0, 0);
+							if (zeit < 0) break; // kein Prozessgitter, alle Procs von teil brechen ab
+							if (w >= optionen.bench_aufwaermen) zeiten[w - optionen.bench_aufwaermen] = zeit;
+						}
+						MPI_Comm_free(&teil);
+					}
+					MPI_Barrier(_comm);
+
+					// ohne Prozessgitter (ROOT hat den Fehler gemeldet) keine CSV-Zeile für den Messpunkt
+					if (my_rank == ROOT && zeit >= 0) {
+						// sortieren (wenige Werte -> Einfügen) für Minimum, Median und Maximum
+						for (w = 1; w < optionen.bench_wdh; w++) {
+							zeit = zeiten[w];
+							for (i = w; i > 0 && zeiten[i - 1] > zeit; i--)
+								zeiten[i] = zeiten[i - 1];
+							zeiten[i] = zeit;
+						}
+						zeit = (optionen.bench_wdh % 2) ? zeiten[optionen.bench_wdh / 2]
+								: (zeiten[optionen.bench_wdh / 2 - 1] + zeiten[optionen.bench_wdh / 2]) / 2;
+						fprintf(aus, "%s,%d,%d,%s,%d,%d,%d,%.6f,%.6f,%.6f,%.4e\n", (art == GOL_STARK) ? "stark" : "schwach", procs[n], _threads,
+								GOL_kernel_name, dim, runden[r], optionen.bench_wdh, zeiten[0], zeit, zeiten[optionen.bench_wdh - 1],
+								(double) dim * dim * runden[r] / zeit / procs[n]);
+						fflush(aus);
+					}
+				}
+			}
+		}
+	}
+
+	if (aus != stdout) fclose(aus);
+	free(zeiten);
+}
+
+/**
+ * Kernel-Messung: je Kernel und Cache-Stufe ein Spielfeld, dessen zwei Generationen die Hälfte der Stufe belegen
+ * (Hauptspeicher: das Vierfache von L3); nach einer ungemessenen Runde wird mit GOL_block ohne Threads gerechnet,
+ * bis GOL_KERNEL_MESSZEIT vergangen ist. Vorher rechnet jeder Kernel einige Runden auf einem kleinen Spielfeld mit
+ * angebrochenem letzten Wort, das Ergebnis muss Bit für Bit dem des skalaren Kernels gleichen.
+ */
+#define GOL_KERNEL_MESSZEIT 0.2 // Sekunden je Messpunkt (mindestens)
+#define GOL_KERNEL_PRUEF_DIM 300 // Spielfeld für den Vergleich mit dem skalaren Kernel
+#define GOL_KERNEL_PRUEF_RUNDEN 16
+void GOL_kernel_messen(FILE *_aus) {
+	static const char *stufe_name[4] = { "L1", "L2", "L3", "DRAM" };
+	long groesse[4] = { 32L << 10, 1L << 20, 32L << 20, 0 }; // Bytes je Stufe (ohne sysconf: typische Werte)
+	int q, t, r, i; // für Schleifen
+	int dim, worte; // Spielfeld der Messung
+	int skalar; // Eintrag des skalaren Kernels
+	uint64_t **alt, **neu, **swap, **referenz = NULL; // Spielfelder, Ergebnis des skalaren Kernels
+	uint64_t maske; // gültige Bits im letzten Wort
+	double start, zeit; // Messung
+	char regel_text[24]; // Regel für die Ausgabe
+	void (*aktiv)(const uint64_t *, const uint64_t *, const uint64_t *, uint64_t *, int, int) = GOL_zeile; // gewählter Kernel
+
+#ifdef _SC_LEVEL3_CACHE_SIZE
+	if (sysconf(_SC_LEVEL1_DCACHE_SIZE) > 0) groesse[0] = sysconf(_SC_LEVEL1_DCACHE_SIZE);
+	if (sysconf(_SC_LEVEL2_CACHE_SIZE) > 0) groesse[1] = sysconf(_SC_LEVEL2_CACHE_SIZE);
+	if (sysconf(_SC_LEVEL3_CACHE_SIZE) > 0) groesse[2] = sysconf(_SC_LEVEL3_CACHE_SIZE);
+#endif
+	groesse[3] = 4 * groesse[2];
+	for (skalar = 0; GOL_kernel_liste[skalar].isa != NULL; skalar++);
+	GOL_regel_text(regel_text, GOL_regel.geburt, GOL_regel.ueberleben);
+	fprintf(_aus, "kernel,regel,stufe,bytes,dim,runden,s,zellen_pro_ns\n");
+	fflush(_aus);
+
+	for (q = skalar; q >= 0; q--) {
+		if (!GOL_kernel_verfuegbar(&GOL_kernel_liste[q])) continue;
+		GOL_zeile = GOL_kernel_liste[q].zeile[GOL_regel_nr];
+
+		// Vergleich mit dem skalaren Kernel (der als erster rechnet und die Referenz liefert)
+		dim = GOL_KERNEL_PRUEF_DIM;
+		worte = GOL_worte(dim) + 2;
+		maske = GOL_maske(dim);
+		alt = malloc2D_bits(dim + 2, worte);
+		neu = malloc2D_bits(dim + 2, worte);
+		GOL_zufall_fuellen(alt, neu, 1, dim, worte - 2, dim, 0, 0);
+		for (r = 0; r < GOL_KERNEL_PRUEF_RUNDEN; r++) {
+			GOL_block(alt, neu, 1, dim + 1, 1, worte - 1, worte, maske, ~(uint64_t) 0);
+			swap = alt;
+			alt = neu;
+			neu = swap;
+		}
+		free2D_bits(neu);
+		if (referenz == NULL) {
+			referenz = alt;
+		} else {
+			for (i = 1; i <= dim && memcmp(alt[i], referenz[i], worte * sizeof(uint64_t)) == 0; i++);
+			if (i <= dim) printf("Error: Kernel %s weicht nach %d Runden in Zeile %d vom skalaren Kernel ab\n", GOL_kernel_liste[q].name,
+					GOL_KERNEL_PRUEF_RUNDEN, i);
+			free2D_bits(alt);
+		}
+
+		// Messung je Stufe: zwei Generationen zu je etwa dim * dim / 8 Bytes
+		for (t = 0; t < 4; t++) {
+			for (dim = 64; (long) (dim + 64) * (dim + 64) / 4 <= groesse[t] / 2; dim += 64);
+			worte = GOL_worte(dim) + 2;
+			maske = GOL_maske(dim);
+			alt = malloc2D_bits(dim + 2, worte);
+			neu = malloc2D_bits(dim + 2, worte);
+			GOL_zufall_fuellen(alt, neu, 1, dim, worte - 2, dim, 0, 0);
+			GOL_block(alt, neu, 1, dim + 1, 1, worte - 1, worte, maske, ~(uint64_t) 0);
+			start = MPI_Wtime();
+			for (r = 0; (zeit = MPI_Wtime() - start) < GOL_KERNEL_MESSZEIT || r < 3; r++) {
+				GOL_block(alt, neu, 1, dim + 1, 1, worte - 1, worte, maske, ~(uint64_t) 0);
+				swap = alt;
+				alt = neu;
+				neu = swap;
+			}
+			fprintf(_aus, "%s,%s,%s,%ld,%d,%d,%.6f,%.4f\n", GOL_kernel_liste[q].name, regel_text, stufe_name[t],
+					(long) 2 * (dim + 2) * worte * (long) sizeof(uint64_t), dim, r, zeit, (double) dim * dim * r / zeit * 1e-9);
+			fflush(_aus);
+			free2D_bits(alt);
+			free2D_bits(neu);
+		}
+	}
+	free2D_bits(referenz);
+	GOL_zeile = aktiv;
+}
+
+/**
+ * Ausgelagertes Spielfeld für die Prüfung: eigene Spielfelddateien (Präfix + "_pruefen"), danach gelöscht
+ */
+static void GOL_pruefen_datei(int _dim, int _runden) {
+	char praefix[256], datei[300]; // Präfix des Spiels, Spielfelddatei der Prüfung
+	int i; // für Schleife
+	memcpy(praefix, optionen.datei_praefix, sizeof(praefix));
+	snprintf(optionen.datei_praefix, sizeof(optionen.datei_praefix), "%.240s_pruefen", praefix);
+	GOL_datei(_dim, _runden);
+	for (i = 0; i < 2; i++) {
+		snprintf(datei, sizeof(datei), "%s_%d.bin", optionen.datei_praefix, i);
+		remove(datei);
+	}
+	memcpy(optionen.datei_praefix, praefix, sizeof(praefix));
+}
+
+/**
+ * Prüfung: ROOT rechnet erst seriell (Referenz), dann rechnen die ersten p Procs auf einem eigenen Kommunikator mit
+ * GOL_parallel; das Endspielfeld landet über GOL_ergebnis bei ROOT und wird mit der Referenz verglichen (eigene
+ * Worte jeder Zeile einschließlich der Auffüllbits, die tot bleiben müssen). Abweichungen meldet ROOT mit der Anzahl
+ * der verschiedenen Zellen und der ersten verschiedenen Zelle, am Ende eine Zusammenfassung.
+ */
+int GOL_pruefen(MPI_Comm _comm) {
+	int my_rank, nprocs; // eigene Prozess-ID und Prozessanzahl
+	int d, r, p, i, w, b; // für Schleifen
+	int dim, worte; // Spielfeld des Prüfpunkts
+	int laeufe = 0, fehler = 0; // geprüfte und abweichende Läufe (nur ROOT)
+	int zeile = 0, spalte = 0; // erste abweichende Zelle
+	long long anzahl; // abweichende Zellen
+	double zeit; // Rückgabe von GOL_parallel (-1: kein Prozessgitter)
+	char lauf[32]; // Lauf für die Ausgabe
+	uint64_t x; // abweichende Bits eines Wortes
+	uint64_t **referenz = NULL; // Ergebnis der seriellen Version (nur ROOT)
+	static const int std_dims[3] = { 1000, 2000, 4000 }; // Standard-Dimensionen wie im Benchmark
+	static const int std_runden[1] = { 100 }; // Standard-Rundenanzahl
+	const int *dims = optionen.bench_n_dims > 0 ? optionen.bench_dims : std_dims;
+	const int *runden = optionen.bench_n_runden > 0 ? optionen.bench_runden : std_runden;
+	int n_dims = optionen.bench_n_dims > 0 ? optionen.bench_n_dims : 3;
+	int n_runden = optionen.bench_n_runden > 0 ? optionen.bench_n_runden : 1;
+	MPI_Comm teil; // Kommunikator der ersten p Procs
+
+	MPI_Comm_rank(_comm, &my_rank);
+	MPI_Comm_size(_comm, &nprocs);
+
+	for (d = 0; d < n_dims; d++) {
+		for (r = 0; r < n_runden; r++) {
+			dim = dims[d];
+			worte = GOL_worte(dim) + 2;
+			if (my_rank == ROOT) {
+				referenz = malloc2D_bits(dim + 2, worte);
+				GOL_ergebnis = referenz;
+				GOL_seriell(dim, runden[r], 0, 0, 0);
+				GOL_ergebnis = malloc2D_bits(dim + 2, worte);
+			}
+
+			// p = 0: Hashlife bzw. ausgelagertes Spielfeld bei ROOT (nur mit -engine hashlife bzw. datei), sonst die ersten p Procs parallel
+			for (p = (optionen.engine != GOL_STENCIL) ? 0 : 1; p <= nprocs; p++) {
+				if (my_rank == ROOT) memset(GOL_ergebnis[0], 0, (size_t) (dim + 2) * worte * sizeof(uint64_t));
+				zeit = 0;
+				if (p == 0) {
+					if (my_rank == ROOT && optionen.engine == GOL_HASHLIFE) GOL_hashlife(dim, runden[r], 0, 0, 0);
+					else if (my_rank == ROOT) GOL_pruefen_datei(dim, runden[r]);
+				} else {
+					MPI_Comm_split(_comm, (my_rank < p) ? 0 : MPI_UNDEFINED, my_rank, &teil);
+					if (teil != MPI_COMM_NULL) {
+						zeit = GOL_parallel(dim, runden[r], teil, 0, 0, 0);
+						MPI_Comm_free(&teil);
+					}
+				}
+				MPI_Barrier(_comm);
+				if (my_rank != ROOT) continue;
+
+				laeufe++;
+				if (zeit < 0) {
+					// kein Prozessgitter: das Ergebnis ist nicht gefüllt, der Lauf zählt als abweichend
+					fehler++;
+					printf("Error: dim %d, %d Runden, %d Procs: kein Prozessgitter, nicht geprüft\n", dim, runden[r], p);
+					continue;
+				}
+				anzahl = 0;
+				for (i = dim; i >= 1; i--) {
+					for (w = worte - 2; w >= 1; w--) {
+						if ((x = GOL_ergebnis[i][w] ^ referenz[i][w]) == 0) continue;
+						anzahl += GOL_POPCOUNT(x);
+						for (b = 0; !((x >> b) & 1); b++);
+						zeile = i;
+						spalte = (w - 1) * WORT_BITS + b + 1;
+					}
+				}
+				if (p == 0) snprintf(lauf, sizeof(lauf), (optionen.engine == GOL_HASHLIFE) ? "Hashlife" : "Datei");
+				else snprintf(lauf, sizeof(lauf), "%d Procs", p);
+				if (anzahl > 0) {
+					fehler++;
+					printf("Error: dim %d, %d Runden, %s: %lld Zellen weichen von der seriellen Version ab, erste in Zeile %d, Spalte %d\n", dim,
+							runden[r], lauf, anzahl, zeile, spalte);
+				} else {
+					printf("dim %d, %d Runden, %s: gleich\n", dim, runden[r], lauf);
+				}
+			}
+
+			if (my_rank == ROOT) {
+				free2D_bits(referenz);
+				free2D_bits(GOL_ergebnis);
+				GOL_ergebnis = NULL;
+			}
+		}
+	}
+	if (my_rank == ROOT) {
+		if (fehler > 0) printf("Prüfung: %d von %d Läufen weichen ab\n", fehler, laeufe);
+		else printf("Prüfung bestanden: %d Läufe gleich der seriellen Version\n", laeufe);
+	}
+	return fehler;
+}
+
+/**
+ * Ensemble: jeder Thread rechnet einen Streifen aus breite Brettern nebeneinander, Brett s in den Worten
+ * [1 + s * (nw + 1), 1 + s * (nw + 1) + nw), dahinter ein totes Trennwort (beim letzten Brett das rechte Randwort).
+ * Nach jeder Runde werden die Trennworte gelöscht und die angebrochenen letzten Worte maskiert, so sieht jedes Brett
+ * einen toten Rand. Ein fertiges Brett (Zyklus bis zur Periode P oder _runden Runden) macht seinen Platz frei, der
+ * mit dem nächsten Brett des Procs gefüllt wird.
+ * Vorrat des Procs: Bretter [von, bis) werden vergeben, [vorrat_von, vorrat_bis) ist der schon geholte nächste Block;
+ * nur der Hauptthread holt Blöcke (MPI_THREAD_FUNNELED), jeweils sobald der Vorrat vergeben ist.
+ */
+#define GOL_ENSEMBLE_PERIODE 30 // größte erkannte Periode ohne -zyklus
+#define GOL_ENSEMBLE_ERGEBNIS 5 // je Brett: Brett, erste Runde des Zyklus, Periode, Runden, lebende Zellen
+double GOL_ensemble(MPI_Comm _comm, int _dim, int _runden) {
+	int my_rank, nprocs; // eigene Prozess-ID und Prozessanzahl
+	int nw = GOL_worte(_dim); // Worte pro Zeile eines Bretts
+	uint64_t maske = GOL_maske(_dim); // gültige Bits im letzten Wort eines Bretts
+	int breite = (optionen.ensemble_breite > 0) ? optionen.ensemble_breite : ((nw + 1 < 32) ? 32 / (nw + 1) : 1); // Bretter pro Streifen
+	int worte = breite * (nw + 1) + 1; // Worte pro Zeile des Streifens
+	int periode = (optionen.zyklus > 0) ? optionen.zyklus : GOL_ENSEMBLE_PERIODE; // größte erkannte Periode
+	int dichte = (int) (optionen.dichte * 65536 + 0.5); // Dichte in 1/65536
+	long long n_bretter = optionen.ensemble; // Anzahl der Bretter
+	long long block; // Bretter pro geholtem Block
+	long long von = 0, bis = 0, vorrat_von = 0, vorrat_bis = 0; // Vorrat des Procs
+	int erschoepft = 0; // alle Bretter sind vergeben
+	long long *ergebnis = NULL, n_ergebnis = 0, max_ergebnis = 0; // Ergebnisse des Procs
+	long long *alle = NULL; // nur ROOT: Ergebnisse aller Bretter, nach Brett geordnet
+	int n_eintraege; // eigene Einträge in ergebnis
+	int *anzahl = NULL, *versatz = NULL; // nur ROOT: Einträge und Versatz je Proc
+	long long p, stabil = 0; // für Schleife, Bretter mit Zyklus
+	int threads = 1; // Threads des Procs
+	double proc_zeit, max_zeit; // Rechenzeit
+	FILE *aus = stdout; // Ziel der CSV-Zeilen
+#if MPI_VERSION >= 3
+	MPI_Win fenster; // Zähler der vergebenen Bretter bei ROOT
+	long long *zaehler; // ... bei ROOT
+#else
+	long long naechster = 0; // ohne MPI-3: feste Verteilung, nächster eigener Block
+#endif
+
+	MPI_Comm_rank(_comm, &my_rank);
+	MPI_Comm_size(_comm, &nprocs);
+#ifdef _OPENMP
+	threads = omp_get_max_threads();
+#endif
+	block = (long long) threads * breite;
+#if MPI_VERSION >= 3
+	MPI_Win_allocate((my_rank == ROOT) ? sizeof(long long) : 0, sizeof(long long), MPI_INFO_NULL, _comm, &zaehler, &fenster);
+	MPI_Win_lock_all(0, fenster);
+	if (my_rank == ROOT) {
+		*zaehler = 0;
+		MPI_Win_sync(fenster);
+	}
+#endif
+	if (my_rank == ROOT && optionen.ausgabe)
+		printf("Ensemble: %lld Bretter %d x %d, %d pro Streifen, bis %d Runden, Perioden bis %d\n", n_bretter, _dim, _dim, breite, _runden,
+				periode);
+	MPI_Barrier(_comm);
+	proc_zeit = MPI_Wtime();
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+	{
+		int s, i, w, q; // für Schleifen
+		int hauptthread = 1; // darf MPI aufrufen
+		int aktiv = 0, fertig; // belegte Plätze, Brett fertig
+		int basis; // erstes Wort eines Bretts im Streifen
+		long long b, start; // Brett, erstes Brett eines geholten Blocks
+		uint64_t h; // Fingerabdruck
+		long long lebende; // lebende Zellen eines fertigen Bretts
+		uint64_t **alt = malloc2D_bits(_dim + 2, worte), **neu = malloc2D_bits(_dim + 2, worte), **swap; // Streifen
+		long long *brett = (long long *) malloc(breite * sizeof(long long)); // Brett je Platz (-1 = frei)
+		int *runde = (int *) malloc(breite * sizeof(int)); // Generation je Platz
+		uint64_t *verlauf = (uint64_t *) malloc((size_t) breite * (periode + 1) * sizeof(uint64_t)); // Fingerabdrücke je Platz (Ring)
+
+#ifdef _OPENMP
+		hauptthread = (omp_get_thread_num() == 0);
+#endif
+		for (s = 0; s < breite; s++)
+			brett[s] = -1;
+
+		for (;;) {
+			// nächsten Block holen, sobald der Vorrat vergeben ist (nur der Hauptthread)
+			if (hauptthread) {
+				start = -1;
+#ifdef _OPENMP
+#pragma omp critical (GOL_ensemble_vorrat)
+#endif
+				if (vorrat_von >= vorrat_bis && !erschoepft) start = 0;
+				if (start == 0) {
+#if MPI_VERSION >= 3
+					MPI_Fetch_and_op(&block, &start, MPI_LONG_LONG, ROOT, 0, MPI_SUM, fenster);
+					MPI_Win_flush(ROOT, fenster);
+#else
+					start = (naechster++ * nprocs + my_rank) * block;
+#endif
+#ifdef _OPENMP
+#pragma omp critical (GOL_ensemble_vorrat)
+#endif
+					{
+						if (start >= n_bretter) erschoepft = 1;
+						else {
+							vorrat_von = start;
+							vorrat_bis = (start + block < n_bretter) ? start + block : n_bretter;
+						}
+					}
+				}
+			}
+
+			// freie Plätze mit Brettern aus dem Vorrat füllen
+			for (s = 0; s < breite; s++) {
+				if (brett[s] >= 0) continue;
+#ifdef _OPENMP
+#pragma omp critical (GOL_ensemble_vorrat)
+#endif
+				{
+					if (von >= bis && vorrat_von < vorrat_bis) {
+						von = vorrat_von;
+						bis = vorrat_bis;
+						vorrat_von = vorrat_bis = 0;
+					}
+					b = (von < bis) ? von++ : -1;
+				}
+				if (b < 0) break;
+				basis = 1 + s * (nw + 1);
+				for (i = 0; i < _dim; i++) {
+					for (w = 0; w < nw; w++)
+						alt[i + 1][basis + w] = GOL_zufall_wort(optionen.saat + (uint64_t) b, i, w, dichte);
+					alt[i + 1][basis + nw - 1] &= maske;
+				}
+				brett[s] = b;
+				runde[s] = 0;
+				h = 0;
+				for (i = 1; i <= _dim; i++)
+					for (w = 0; w < nw; w++)
+						h += GOL_wort_hash(alt[i][basis + w], i - 1, w);
+				verlauf[(size_t) s * (periode + 1)] = h;
+				aktiv++;
+			}
+			if (aktiv == 0) {
+#ifdef _OPENMP
+#pragma omp critical (GOL_ensemble_vorrat)
+#endif
+				fertig = erschoepft && von >= bis && vorrat_von >= vorrat_bis;
+				if (fertig) break;
+				continue;
+			}
+
+			// eine Runde für den ganzen Streifen, danach Trennworte löschen und letzte Worte maskieren
+			GOL_block(alt, neu, 1, _dim + 1, 1, worte - 1, worte, maske, 0);
+			for (i = 1; i <= _dim; i++) {
+				for (s = 0; s < breite; s++) {
+					basis = 1 + s * (nw + 1);
+					neu[i][basis + nw - 1] &= maske;
+					neu[i][basis + nw] = 0;
+				}
+			}
+			swap = alt;
+			alt = neu;
+			neu = swap;
+
+			// je Brett: Zyklus (gleicher Fingerabdruck wie vor p Runden) oder letzte Runde?
+			for (s = 0; s < breite; s++) {
+				if (brett[s] < 0) continue;
+				basis = 1 + s * (nw + 1);
+				runde[s]++;
+				h = 0;
+				for (i = 1; i <= _dim; i++)
+					for (w = 0; w < nw; w++)
+						h += GOL_wort_hash(alt[i][basis + w], i - 1, w);
+				for (q = 1; q <= periode && q <= runde[s]; q++)
+					if (verlauf[(size_t) s * (periode + 1) + (runde[s] - q) % (periode + 1)] == h) break;
+				fertig = (q <= periode && q <= runde[s]);
+				verlauf[(size_t) s * (periode + 1) + runde[s] % (periode + 1)] = h;
+				if (!fertig && runde[s] < _runden) continue;
+
+				lebende = 0;
+				for (i = 1; i <= _dim; i++)
+					for (w = 0; w < nw; w++)
+						lebende += GOL_POPCOUNT(alt[i][basis + w]);
+#ifdef _OPENMP
+#pragma omp critical (GOL_ensemble_ergebnis)
+#endif
+				{
+					if (n_ergebnis == max_ergebnis) {
+						max_ergebnis = (max_ergebnis > 0) ? 2 * max_ergebnis : 1024;
+						ergebnis = (long long *) realloc(ergebnis, max_ergebnis * GOL_ENSEMBLE_ERGEBNIS * sizeof(long long));
+					}
+					ergebnis[n_ergebnis * GOL_ENSEMBLE_ERGEBNIS] = brett[s];
+					ergebnis[n_ergebnis * GOL_ENSEMBLE_ERGEBNIS + 1] = fertig ? runde[s] - q : -1;
+					ergebnis[n_ergebnis * GOL_ENSEMBLE_ERGEBNIS + 2] = fertig ? q : 0;
+					ergebnis[n_ergebnis * GOL_ENSEMBLE_ERGEBNIS + 3] = runde[s];
+					ergebnis[n_ergebnis * GOL_ENSEMBLE_ERGEBNIS + 4] = lebende;
+					n_ergebnis++;
+				}
+				brett[s] = -1;
+				aktiv--;
+			}
+		}
+		free2D_bits(alt);
+		free2D_bits(neu);
+		free(brett);
+		free(runde);
+		free(verlauf);
+	}
+	proc_zeit = MPI_Wtime() - proc_zeit;
+#if MPI_VERSION >= 3
+	MPI_Win_unlock_all(fenster);
+	MPI_Win_free(&fenster);
+#endif
+
+	// Ergebnisse bei ROOT zusammentragen, nach Brett ordnen und als CSV schreiben
+	n_eintraege = (int) (n_ergebnis * GOL_ENSEMBLE_ERGEBNIS);
+	if (my_rank == ROOT) {
+		anzahl = (int *) malloc(nprocs * sizeof(int));
+		versatz = (int *) malloc(nprocs * sizeof(int));
+	}
+	MPI_Gather(&n_eintraege, 1, MPI_INT, anzahl, 1, MPI_INT, ROOT, _comm);
+	if (my_rank == ROOT) {
+		for (p = 0; p < nprocs; p++)
+			versatz[p] = (p == 0) ? 0 : versatz[p - 1] + anzahl[p - 1];
+		alle = (long long *) malloc((n_bretter * GOL_ENSEMBLE_ERGEBNIS + 1) * sizeof(long long));
+	}
+	MPI_Gatherv(ergebnis, n_eintraege, MPI_LONG_LONG, (my_rank == ROOT) ? alle : NULL, anzahl, versatz, MPI_LONG_LONG, ROOT, _comm);
+	MPI_Reduce(&proc_zeit, &max_zeit, 1, MPI_DOUBLE, MPI_MAX, ROOT, _comm);
+
+	if (my_rank == ROOT) {
+		ergebnis = (long long *) realloc(ergebnis, (n_bretter * GOL_ENSEMBLE_ERGEBNIS + 1) * sizeof(long long));
+		for (p = 0; p < n_bretter; p++)
+			memcpy(&ergebnis[alle[p * GOL_ENSEMBLE_ERGEBNIS] * GOL_ENSEMBLE_ERGEBNIS], &alle[p * GOL_ENSEMBLE_ERGEBNIS],
+					GOL_ENSEMBLE_ERGEBNIS * sizeof(long long));
+		if (optionen.ensemble_datei[0] != '\0' && (aus = fopen(optionen.ensemble_datei, "w")) == NULL) {
+			printf("Error: %s kann nicht geschrieben werden, Ergebnisse auf der Standardausgabe\n", optionen.ensemble_datei);
+			aus = stdout;
+		}
+		fprintf(aus, "brett,saat,zyklus_ab,periode,runden,lebende\n");
+		for (p = 0; p < n_bretter; p++) {
+			fprintf(aus, "%lld,%llu,%lld,%lld,%lld,%lld\n", p, optionen.saat + (unsigned long long) p, ergebnis[p * GOL_ENSEMBLE_ERGEBNIS + 1],
+					ergebnis[p * GOL_ENSEMBLE_ERGEBNIS + 2], ergebnis[p * GOL_ENSEMBLE_ERGEBNIS + 3], ergebnis[p * GOL_ENSEMBLE_ERGEBNIS + 4]);
+			stabil += (ergebnis[p * GOL_ENSEMBLE_ERGEBNIS + 2] > 0);
+		}
+		if (aus != stdout) fclose(aus);
+		if (optionen.ausgabe)
+			printf("Ensemble: %lld von %lld Brettern mit Zyklus, %.1f Bretter pro Sekunde\n", stabil, n_bretter,
+					(max_zeit > 0) ? n_bretter / max_zeit : 0);
+		free(alle);
+		free(anzahl);
+		free(versatz);
+	}
+	free(ergebnis);
+	return max_zeit;
+}
+
+/**
+ * Zustand der Zeitmessung pro Phase (jeder Proc für sich)
+ * Zeiten werden in Takten von GOL_TAKT gezählt und erst am Ende über MPI_Wtime in Sekunden umgerechnet
+ */
+#define GOL_ZAEHLER 3 // Hardwarezähler: Takte, Befehle, Cache-Fehlzugriffe
+#define GOL_SPUR_MAX (1 << 22) // höchstens so viele Einträge in der Spur (je 24 Byte)
+typedef struct {
+	uint64_t beginn, dauer; // Takt beim Beginn (ab dem Start) und Dauer in Takten
+	int phase, runde; // Phase und Runde
+} GOL_spur_eintrag;
+static struct {
+	int phase, runde; // laufende Phase (-1 = keine) und Runde
+	uint64_t beginn; // Takt beim Beginn der laufenden Phase
+	uint64_t takt0; // Takt beim Start
+	double zeit0; // MPI_Wtime beim Start
+	uint64_t takte[GOL_PHASEN]; // Takte je Phase
+	int perf_fd[GOL_ZAEHLER]; // Hardwarezähler, perf_fd[0] führt die Gruppe
+	int perf_n; // Anzahl der geöffneten Hardwarezähler
+	long long zaehler_beginn[GOL_ZAEHLER]; // Zählerstände beim Beginn der laufenden Phase
+	long long zaehler[GOL_PHASEN][GOL_ZAEHLER]; // Zählerstände je Phase
+	GOL_spur_eintrag *spur; // Spur (NULL = keine)
+	size_t spur_n, spur_max; // belegte und reservierte Einträge
+	int spur_voll; // Spur war voll, spätere Abschnitte fehlen
+} GOL_prof;
+static const char *GOL_phasen_name[GOL_PHASEN] = { "austausch", "innen", "warten", "rechnen", "sammeln", "ausgabe", "sichern", "umverteilen", "zyklus" };
+
+/**
+ * Hardwarezähler lesen (alle Zähler der Gruppe mit einem Systemaufruf), 0 = nicht verfügbar
+ */
+static int GOL_zaehler_lesen(long long *_werte) {
+#if GOL_PERF
+	uint64_t puffer[1 + GOL_ZAEHLER]; // Anzahl, dann die Werte der Gruppe
+	int z; // für Schleife
+	if (read(GOL_prof.perf_fd[0], puffer, sizeof(puffer)) < (ssize_t) ((1 + GOL_prof.perf_n) * sizeof(uint64_t))) return 0;
+	for (z = 0; z < GOL_prof.perf_n; z++)
+		_werte[z] = (long long) puffer[1 + z];
+	return 1;
+#else
+	(void) _werte;
+	return 0;
+#endif
+}
+
+/**
+ * Hardwarezähler des aufrufenden Threads als Gruppe öffnen (nur Benutzermodus), liefert die Anzahl der Zähler
+ */
+static int GOL_zaehler_oeffnen(void) {
+#if GOL_PERF
+	static const uint64_t art[GOL_ZAEHLER] = { PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS, PERF_COUNT_HW_CACHE_MISSES };
+	struct perf_event_attr attr; // Beschreibung eines Zählers
+	int z; // für Schleife
+
+	for (z = 0; z < GOL_ZAEHLER; z++) {
+		memset(&attr, 0, sizeof(attr));
+		attr.size = sizeof(attr);
+		attr.type = PERF_TYPE_HARDWARE;
+		attr.config = art[z];
+		attr.disabled = (z == 0);
+		attr.exclude_kernel = 1;
+		attr.exclude_hv = 1;
+		attr.read_format = PERF_FORMAT_GROUP;
+		GOL_prof.perf_fd[z] = (int) syscall(__NR_perf_event_open, &attr, 0, -1, (z == 0) ? -1 : GOL_prof.perf_fd[0], 0);
+		if (GOL_prof.perf_fd[z] < 0) break;
+	}
+	if (z > 0) {
+		ioctl(GOL_prof.perf_fd[0], PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+		ioctl(GOL_prof.perf_fd[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+	}
+	return z;
+#else
+	return 0;
+#endif
+}
+
+void GOL_profil_start(MPI_Comm _comm) {
+	if (!optionen.profil) return;
+
+	memset(&GOL_prof, 0, sizeof(GOL_prof));
+	GOL_prof.phase = -1;
+	if (optionen.profil > 1) GOL_prof.perf_n = GOL_zaehler_oeffnen();
+	if (optionen.spur[0] != '\0') {
+		GOL_prof.spur_max = 4096;
+		GOL_prof.spur = (GOL_spur_eintrag *) malloc(GOL_prof.spur_max * sizeof(GOL_spur_eintrag));
+	}
+
+	// gemeinsamer Start: die Spuren aller Procs beginnen (ungefähr) im selben Moment
+	MPI_Barrier(_comm);
+	GOL_prof.zeit0 = MPI_Wtime();
+	GOL_prof.takt0 = GOL_TAKT();
+}
+
+void GOL_phase(int _phase, int _runde) {
+	uint64_t jetzt = GOL_TAKT(); // Takt beim Phasenwechsel
+	long long werte[GOL_ZAEHLER]; // Zählerstände beim Phasenwechsel
+	int p = GOL_prof.phase, z; // laufende Phase, für Schleife
+
+	if (_phase == p && _runde == GOL_prof.runde) return;
+
+	if (p >= 0) {
+		GOL_prof.takte[p] += jetzt - GOL_prof.beginn;
+		if (GOL_prof.spur != NULL) {
+			// Spur verdoppeln bis GOL_SPUR_MAX, danach nur noch Summen
+			if (GOL_prof.spur_n == GOL_prof.spur_max && GOL_prof.spur_max < GOL_SPUR_MAX) {
+				GOL_prof.spur_max *= 2;
+				GOL_prof.spur = (GOL_spur_eintrag *) realloc(GOL_prof.spur, GOL_prof.spur_max * sizeof(GOL_spur_eintrag));
 			}
+			if (GOL_prof.spur_n < GOL_prof.spur_max)
+				GOL_prof.spur[GOL_prof.spur_n++] = (GOL_spur_eintrag) { GOL_prof.beginn - GOL_prof.takt0, jetzt - GOL_prof.beginn, p, GOL_prof.runde };
+			else
+				GOL_prof.spur_voll = 1;
+		}
+	}
+	if (GOL_prof.perf_n > 0 && GOL_zaehler_lesen(werte)) {
+		for (z = 0; z < GOL_prof.perf_n; z++) {
+			if (p >= 0) GOL_prof.zaehler[p][z] += werte[z] - GOL_prof.zaehler_beginn[z];
+			GOL_prof.zaehler_beginn[z] = werte[z];
 		}
+	}
+
+	GOL_prof.phase = _phase;
+	GOL_prof.runde = _runde;
+	GOL_prof.beginn = GOL_TAKT();
+}
+
+/**
+ * Auswertung der Zeitmessung: Minimum, Mittel und Maximum der Phasenzeiten über alle Procs, Ungleichgewicht
+ * (Maximum / Mittel - 1) und der langsamste Proc je Phase; mit Hardwarezählern deren Summen über alle Procs.
+ * Jeder Proc schreibt seine Spur selbst (Chrome-Trace-Format, Zeiten in Mikrosekunden ab dem gemeinsamen Start).
+ */
+void GOL_profil_ende(MPI_Comm _comm) {
+	int my_rank, nprocs; // eigene Prozess-ID und Prozessanzahl
+	int p, z; // für Schleifen
+	size_t e; // für Schleife über die Spur
+	double takte_pro_s; // Umrechnung Takte -> Sekunden
+	double sek[GOL_PHASEN], sek_min[GOL_PHASEN], sek_max[GOL_PHASEN], sek_summe[GOL_PHASEN], gesamt = 0; // Phasenzeiten
+	struct {
+		double wert;
+		int rang;
+	} langsam[GOL_PHASEN], langsamster[GOL_PHASEN]; // für MPI_MAXLOC (MPI_DOUBLE_INT)
+	long long zaehler_summe[GOL_PHASEN][GOL_ZAEHLER]; // Hardwarezähler aller Procs
+	int perf_n; // Anzahl der Hardwarezähler, die alle Procs haben
+	char datei[300]; // Name der Spurdatei
+	FILE *f; // Spurdatei
+
+	if (!optionen.profil) return;
+	GOL_phase(-1, 0);
+	MPI_Comm_rank(_comm, &my_rank);
+	MPI_Comm_size(_comm, &nprocs);
+
+	// Takte über die seit dem Start vergangene Zeit in Sekunden umrechnen
+	takte_pro_s = (double) (GOL_TAKT() - GOL_prof.takt0) / (MPI_Wtime() - GOL_prof.zeit0);
+	if (!(takte_pro_s > 0)) takte_pro_s = 1e9;
+	for (p = 0; p < GOL_PHASEN; p++) {
+		sek[p] = GOL_prof.takte[p] / takte_pro_s;
+		langsam[p].wert = sek[p];
+		langsam[p].rang = my_rank;
+	}
 
-		// Teilspielfeld vom ROOT "schnell mal" ins das Vollspielfeld kopieren
-		if (my_rank == ROOT) memcpy(&voll[0][0], &my_spielfeld[1][0], my_elements*sizeof(int));
-		// Teilspielfelder anderer Procs an das Vollspielfeld senden
-		else MPI_Send(&my_spielfeld[1][0], my_elements, MPI_INT, ROOT, 99, MPI_COMM_WORLD);
+	MPI_Reduce(sek, sek_min, GOL_PHASEN, MPI_DOUBLE, MPI_MIN, ROOT, _comm);
+	MPI_Reduce(sek, sek_max, GOL_PHASEN, MPI_DOUBLE, MPI_MAX, ROOT, _comm);
+	MPI_Reduce(sek, sek_summe, GOL_PHASEN, MPI_DOUBLE, MPI_SUM, ROOT, _comm);
+	MPI_Reduce(langsam, langsamster, GOL_PHASEN, MPI_DOUBLE_INT, MPI_MAXLOC, ROOT, _comm);
+	MPI_Allreduce(&GOL_prof.perf_n, &perf_n, 1, MPI_INT, MPI_MIN, _comm);
+	if (perf_n > 0) MPI_Reduce(GOL_prof.zaehler, zaehler_summe, GOL_PHASEN * GOL_ZAEHLER, MPI_LONG_LONG, MPI_SUM, ROOT, _comm);
 
-		// Ausgabe des Vollspielfelds in der Konsole
-		if (my_rank == ROOT && screen != NULL) {
-			GOL_gfx(voll, spielfeld_dim);
-			usleep(_speed);
+	if (my_rank == ROOT) {
+		for (p = 0; p < GOL_PHASEN; p++)
+			gesamt += sek_summe[p] / nprocs;
+		printf("Phasenzeiten über %d Procs in Sekunden:\n", nprocs);
+		printf("%-10s %10s %10s %10s %7s %16s %12s\n", "Phase", "Minimum", "Mittel", "Maximum", "Anteil", "Ungleichgewicht", "langsamster");
+		for (p = 0; p < GOL_PHASEN; p++) {
+			if (sek_max[p] <= 0) continue;
+			printf("%-10s %10.6f %10.6f %10.6f %6.1f%% %15.1f%% %12d\n", GOL_phasen_name[p], sek_min[p], sek_summe[p] / nprocs, sek_max[p],
+					(gesamt > 0) ? 100.0 * sek_summe[p] / nprocs / gesamt : 0.0, 100.0 * (sek_max[p] * nprocs / sek_summe[p] - 1),
+					langsamster[p].rang);
+		}
+		if (perf_n > 0) {
+			printf("Hardwarezähler (Hauptthreads aller Procs):\n");
+			printf("%-10s %15s %15s %6s %15s\n", "Phase", "Takte", "Befehle", "IPC", "Cache-Fehler");
+			for (p = 0; p < GOL_PHASEN; p++) {
+				if (zaehler_summe[p][0] <= 0) continue;
+				printf("%-10s %15lld", GOL_phasen_name[p], zaehler_summe[p][0]);
+				if (perf_n > 1) printf(" %15lld %6.2f", zaehler_summe[p][1], (double) zaehler_summe[p][1] / zaehler_summe[p][0]);
+				if (perf_n > 2) printf(" %15lld", zaehler_summe[p][2]);
+				printf("\n");
+			}
+		} else if (optionen.profil > 1) {
+			printf("Hardwarezähler nicht verfügbar (perf_event)\n");
 		}
 	}
 
-	// Rechnezeit berechnen und in proc_zeit speichern (jeder Proc für sich)
-	proc_zeit = MPI_Wtime() - proc_zeit;
-
-	// Die maximale Rechenzeite bestimmen und beim Proc 0 in max_zeit speichern
-	MPI_Reduce(&proc_zeit, &max_zeit, 1, MPI_DOUBLE, MPI_MAX, ROOT, comm);
+	// Spur dieses Procs schreiben
+	if (GOL_prof.spur != NULL) {
+		snprintf(datei, sizeof(datei), "%s_%d.json", optionen.spur, my_rank);
+		if ((f = fopen(datei, "w")) == NULL) {
+			printf("Error: Spur %s kann nicht geschrieben werden\n", datei);
+		} else {
+			fprintf(f, "{\"traceEvents\":[\n{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":%d,\"tid\":0,\"args\":{\"name\":\"Proc %d\"}}", my_rank,
+					my_rank);
+			for (e = 0; e < GOL_prof.spur_n; e++) {
+				fprintf(f, ",\n{\"name\":\"%s\",\"ph\":\"X\",\"pid\":%d,\"tid\":0,\"ts\":%.3f,\"dur\":%.3f,\"args\":{\"runde\":%d}}",
+						GOL_phasen_name[GOL_prof.spur[e].phase], my_rank, GOL_prof.spur[e].beginn / takte_pro_s * 1e6,
+						GOL_prof.spur[e].dauer / takte_pro_s * 1e6, GOL_prof.spur[e].runde);
+			}
+			fprintf(f, "\n],\"displayTimeUnit\":\"ms\"}\n");
+			fclose(f);
+			if (GOL_prof.spur_voll) printf("Proc %d: Spur nach %zu Abschnitten gekürzt\n", my_rank, GOL_prof.spur_n);
+		}
+		free(GOL_prof.spur);
+		GOL_prof.spur = NULL;
+	}
 
-	// längste Rechenzeit zurückgeben
-	return (max_zeit);
+#if GOL_PERF
+	for (z = 0; z < GOL_prof.perf_n; z++)
+		close(GOL_prof.perf_fd[z]);
+#endif
+	GOL_prof.perf_n = 0;
 }
 
 /**
@@ -420,51 +4222,67 @@ double GOL_parallel(int spielfeld_dim, int _runden, MPI_Comm comm, int _speed, i
  */
 double GOL_seriell(int spielfeld_dim, int _runden, int _speed, int _scr_h, int _cell_h) {
 	// Variablen
-	int i, j, k; // für diverse Schleifen
-	int nachbarn; // Summe der Nachbarn
-	int **voll_zwischen, **voll_swap, **voll_spielfeld = NULL; // für Spielfelder
+	int k, d; // für diverse Schleifen
+	int worte = GOL_worte(spielfeld_dim) + 2; // Worte pro Zeile inkl. linkes und rechtes Randwort
+	uint64_t maske = GOL_maske(spielfeld_dim); // gültige Bits im letzten Wort einer Zeile
+	uint64_t **voll_zwischen, **voll_swap, **voll_spielfeld = NULL; // für Spielfelder
+	GOL_kacheln kacheln; // aktive Kacheln
+	int torus_rand[4]; // Torus: Seite OBEN ... RECHTS rechnen, da sich die gegenüberliegende Seite geändert hat
+	GOL_zyklus zyklus; // Fingerabdrücke der letzten Generationen
+	GOL_sicherung sicherung = GOL_SICHERUNG_LEER; // Sicherung, die im Hintergrund geschrieben wird
+	int signal_behandelt = 0; // Anzahl der schon gesicherten Signale
 	double proc_zeit; // für Rechenzeitberechnung
 
 	// alloziere dynamischen Speicher für Vollspielfeld und Zwischenergebnis
-	voll_spielfeld = malloc2D(spielfeld_dim + 2, spielfeld_dim + 2);
-	voll_zwischen = malloc2D(spielfeld_dim + 2, spielfeld_dim + 2);
-
-	// Initialisierung des Aussenrands mit Nullen, entspricht kein Leben ausserhalb des Spielfelds
-	for (i = 0; i < spielfeld_dim + 2; i++)
-		voll_spielfeld[i][0] = voll_spielfeld[i][spielfeld_dim + 1] = voll_zwischen[i][0] = voll_zwischen[i][spielfeld_dim + 1] = 0;
-	for (j = 0; j < spielfeld_dim + 2; j++)
-		voll_spielfeld[0][j] = voll_spielfeld[spielfeld_dim + 1][j] = voll_zwischen[0][j] = voll_zwischen[spielfeld_dim + 1][j] = 0;
-
-	// für "echte" Zufallszhalen
-	srand(time(NULL));
+	// der Aussenrand ist dabei mit Nullen initialisiert, entspricht kein Leben ausserhalb des Spielfelds
+	voll_spielfeld = malloc2D_bits(spielfeld_dim + 2, worte);
+	voll_zwischen = malloc2D_bits(spielfeld_dim + 2, worte);
+	GOL_kacheln_anlegen(&kacheln, 1, spielfeld_dim, worte - 2, 0, 0);
 
-	// Initialisierung des Spielfelds mit Werten, entspricht Anfangsbedingungen
-	for (i = 1; i <= spielfeld_dim; i++) {
-		for (j = 1; j <= spielfeld_dim; j++)
-			voll_spielfeld[i][j] = rand() % 2;
+	// Initialisierung des Spielfelds mit Werten, entspricht Anfangsbedingungen: Sicherung, Musterdatei oder Zufallswerte
+	if (optionen.fortsetzen[0] != '\0') {
+		if (GOL_sicherung_laden(optionen.fortsetzen, MPI_COMM_SELF, voll_spielfeld, 1, worte, spielfeld_dim, 0, spielfeld_dim, 0, worte - 2) != 0)
+			printf("Error: Sicherung %s kann nicht gelesen werden\n", optionen.fortsetzen);
+	} else if (optionen.muster[0] == '\0' || GOL_muster_laden(optionen.muster, MPI_COMM_SELF, spielfeld_dim, voll_spielfeld, 1, 0, spielfeld_dim, 0,
+			spielfeld_dim) != 0) {
+		// Zufallswerte: nur von der Saat und der Lage im Spielfeld abhängig, gleich wie in der parallelen Version
+		GOL_zufall_fuellen(voll_spielfeld, voll_zwischen, 1, spielfeld_dim, worte - 2, spielfeld_dim, 0, 0);
 	}
 
+	// Zykluserkennung: Fingerabdruck der Anfangsgeneration, danach führen ihn die Kacheln nach
+	GOL_zyklus_anlegen(&zyklus);
+	if (optionen.zyklus > 0) kacheln.hash = GOL_kacheln_hash(&kacheln, voll_spielfeld, 1, spielfeld_dim + 1, 1, worte - 1);
+	GOL_zyklus_merken(&zyklus, MPI_COMM_SELF, optionen.start_runde, kacheln.hash, 0);
+
 	// Startzeit speichern
+	GOL_profil_start(MPI_COMM_SELF);
 	proc_zeit = MPI_Wtime();
 
 	// Spiel "_runden-Mal" spielen
-	for (k = 0; k < _runden; k++) {
-		// Nachbarnanzahl in 8-ter Nachbarnschaft bestimen
-		for (i = 1; i < spielfeld_dim + 1; i++) {
-			for (j = 1; j < spielfeld_dim + 1; j++) {
-				// Summe über alle Nachbarn bilden
-				nachbarn = voll_spielfeld[i - 1][j - 1] + voll_spielfeld[i - 1][j] + voll_spielfeld[i - 1][j + 1] + voll_spielfeld[i][j - 1] + voll_spielfeld[i][j + 1]
-						+ voll_spielfeld[i + 1][j - 1] + voll_spielfeld[i + 1][j] + voll_spielfeld[i + 1][j + 1];
-
-				// leben, sterben, neues Leben ?
-				if (nachbarn < 2 || nachbarn > 3) { // 0, 1, 4, 5, ...
-					voll_zwischen[i][j] = 0; // sterben
-				} else if (nachbarn == 3) { // 3
-					voll_zwischen[i][j] = 1; // weiter leben bzw. neues Leben
-				} else { // 2
-					voll_zwischen[i][j] = voll_spielfeld[i][j]; // alten Wert übernehmen
-				}
-			}
+	for (k = optionen.start_runde; k < _runden; k++) {
+		GOL_PHASE(GOL_P_RECHNEN, k + 1);
+
+		// Torus: die gegenüberliegenden Ränder werden zu Randzeilen und Randbits, die Kacheln am Rand hängen dann
+		// von den Kacheln auf der anderen Seite ab
+		if (optionen.torus) {
+			GOL_torus_naehen(voll_spielfeld, 1, spielfeld_dim + 1, worte - 2, spielfeld_dim);
+			memcpy(voll_spielfeld[0], voll_spielfeld[spielfeld_dim], worte * sizeof(uint64_t));
+			memcpy(voll_spielfeld[spielfeld_dim + 1], voll_spielfeld[1], worte * sizeof(uint64_t));
+			for (d = OBEN; d <= RECHTS; d++)
+				torus_rand[d] = GOL_kacheln_seite_geaendert(&kacheln, d ^ 1);
+		}
+
+		// nächste Generation mit dem Bit-Addierwerk bestimmen, 64 Zellen pro Wort (nur Kacheln mit Änderungen in der Nachbarschaft)
+		GOL_kacheln_planen(&kacheln);
+		if (optionen.torus) {
+			for (d = OBEN; d <= RECHTS; d++)
+				if (torus_rand[d]) GOL_kacheln_rand(&kacheln, d);
+		}
+		GOL_kacheln_block(&kacheln, voll_spielfeld, voll_zwischen, 1, spielfeld_dim + 1, 1, worte - 1, worte, maske, 0);
+		if (optionen.torus) {
+			GOL_torus_trennen(voll_spielfeld, 1, spielfeld_dim + 1, worte - 2, maske);
+			memset(voll_spielfeld[0], 0, worte * sizeof(uint64_t));
+			memset(voll_spielfeld[spielfeld_dim + 1], 0, worte * sizeof(uint64_t));
 		}
 
 		// Umadressierung der Spielfelder
@@ -472,24 +4290,751 @@ double GOL_seriell(int spielfeld_dim, int _runden, int _speed, int _scr_h, int _
 		voll_spielfeld = voll_zwischen; // Zwischenergebnis -> wird Endergebnis der aktuellen Spielrunde
 		voll_zwischen = voll_swap; // Zwischenergebnis -> wird Anfangsspielfeld für die nächste Runde
 
-		// Grafische Ausgabe
-		if (screen != NULL) {
-			GOL_gfx(voll_spielfeld, spielfeld_dim);
-			usleep(_speed);
+		// Zykluserkennung: auf Wunsch ist diese Runde die letzte
+		if (optionen.zyklus > 0) {
+			GOL_PHASE(GOL_P_ZYKLUS, k + 1);
+			if (GOL_zyklus_merken(&zyklus, MPI_COMM_SELF, k + 1, kacheln.hash, k + 1 == _runden) && optionen.zyklus_ende) _runden = k + 1;
+		}
+
+		// Grafische Ausgabe (sobald der Renderthread das letzte Bild übernommen hat), Schnappschuss bzw. Ergebnis der letzten Runde
+		GOL_bild_abstimmen(MPI_COMM_NULL);
+		if (GOL_voll_noetig(k + 1, _runden)) {
+			GOL_PHASE(GOL_P_AUSGABE, k + 1);
+			GOL_voll_ausgeben(voll_spielfeld, spielfeld_dim, k + 1, _runden, _speed);
+		}
+
+		// Sicherung: regelmäßig oder auf ein Signal
+		if (optionen.sicherung != 0) {
+			GOL_PHASE(GOL_P_SICHERN, k + 1);
+			if (GOL_signal > signal_behandelt || GOL_sicherung_faellig(k + 1))
+				GOL_sicherung_schreiben(&sicherung, MPI_COMM_SELF, voll_spielfeld, 1, spielfeld_dim, 0, spielfeld_dim, 0, worte - 2, k + 1);
+			else
+				GOL_sicherung_testen(&sicherung);
+			signal_behandelt = GOL_signal;
+			if (GOL_signal_ende) {
+				printf("Auf Signal nach Runde %d beendet, fortsetzen mit -fortsetzen %s\n", k + 1, optionen.sicherung_datei);
+				break;
+			}
+		}
+	}
+	GOL_sicherung_abschliessen(&sicherung);
+
+	// Rechnezeit berechnen und in max_zeit speichern
+	proc_zeit = MPI_Wtime() - proc_zeit;
+	GOL_profil_ende(MPI_COMM_SELF);
+	if (optionen.ausgabe && optionen.kacheln && kacheln.gesamt > 0) printf("Berechnete Kacheln: %.1f %%\n", 100.0 * kacheln.gerechnet / kacheln.gesamt);
+
+	// Speicher freigeben
+	GOL_kacheln_freigeben(&kacheln);
+	GOL_zyklus_freigeben(&zyklus);
+	free2D_bits(voll_spielfeld);
+	free2D_bits(voll_zwischen);
+
+	// gesamte Rechenzeit zurückgeben
+	return (proc_zeit);
+}
+
+/**
+ * Hashtabelle der Hashlife-Knoten
+ * Verkettung über GOL_knoten.kette, die Anzahl der Zeilen ist eine Zweierpotenz und wächst mit
+ */
+static struct {
+	GOL_knoten **zeilen; // Zeilen der Hashtabelle
+	size_t groesse; // Anzahl der Zeilen
+	size_t knoten; // Anzahl der Knoten in der Tabelle
+	size_t grenze; // ab so vielen Knoten wird aufgeräumt
+	GOL_knoten *leer[64]; // leere Knoten je Ebene (immer erreichbar)
+} GOL_hl;
+
+/**
+ * Hashwert eines Knotens aus seinen Quadranten bzw. seinen Zellen (Blatt)
+ */
+static inline size_t GOL_hl_hash(const GOL_knoten *_nw, const GOL_knoten *_no, const GOL_knoten *_sw, const GOL_knoten *_so,
+		uint64_t _bits) {
+	if (_nw == NULL) return (size_t) GOL_mischen(_bits);
+	return (size_t) GOL_mischen((uintptr_t) _nw + 3 * (uintptr_t) _no + 5 * (uintptr_t) _sw + 7 * (uintptr_t) _so);
+}
+
+/**
+ * Hashtabelle anlegen bzw. auf die doppelte Zeilenzahl vergrößern
+ */
+static void GOL_hl_tabelle(size_t _groesse) {
+	GOL_knoten **zeilen = calloc(_groesse, sizeof(GOL_knoten *));
+	GOL_knoten *k, *weiter;
+	size_t i, h;
+	for (i = 0; i < GOL_hl.groesse; i++) {
+		for (k = GOL_hl.zeilen[i]; k != NULL; k = weiter) {
+			weiter = k->kette;
+			h = GOL_hl_hash(k->nw, k->no, k->sw, k->so, k->bits) & (_groesse - 1);
+			k->kette = zeilen[h];
+			zeilen[h] = k;
+		}
+	}
+	free(GOL_hl.zeilen);
+	GOL_hl.zeilen = zeilen;
+	GOL_hl.groesse = _groesse;
+}
+
+/**
+ * Neuen Knoten in Zeile _h der Hashtabelle eintragen
+ */
+static GOL_knoten *GOL_hl_eintragen(size_t _h) {
+	GOL_knoten *k = calloc(1, sizeof(GOL_knoten));
+	if (k == NULL) {
+		printf("Hashlife: kein Speicher mehr frei (%zu Knoten)\n", GOL_hl.knoten);
+		MPI_Abort(MPI_COMM_WORLD, EXIT_FAILURE);
+	}
+	k->kette = GOL_hl.zeilen[_h];
+	GOL_hl.zeilen[_h] = k;
+	GOL_hl.knoten++;
+	return k;
+}
+
+GOL_knoten *GOL_hl_blatt(uint64_t _bits) {
+	size_t h;
+	GOL_knoten *k;
+	if (GOL_hl.knoten >= GOL_hl.groesse) GOL_hl_tabelle(2 * GOL_hl.groesse);
+	h = GOL_hl_hash(NULL, NULL, NULL, NULL, _bits) & (GOL_hl.groesse - 1);
+	for (k = GOL_hl.zeilen[h]; k != NULL; k = k->kette) {
+		if (k->nw == NULL && k->bits == _bits) return k;
+	}
+	k = GOL_hl_eintragen(h);
+	k->bits = _bits;
+	k->lebende = GOL_POPCOUNT(_bits);
+	k->ebene = 3;
+	return k;
+}
+
+GOL_knoten *GOL_hl_knoten(GOL_knoten *_nw, GOL_knoten *_no, GOL_knoten *_sw, GOL_knoten *_so) {
+	size_t h;
+	GOL_knoten *k;
+	if (GOL_hl.knoten >= GOL_hl.groesse) GOL_hl_tabelle(2 * GOL_hl.groesse);
+	h = GOL_hl_hash(_nw, _no, _sw, _so, 0) & (GOL_hl.groesse - 1);
+	for (k = GOL_hl.zeilen[h]; k != NULL; k = k->kette) {
+		if (k->nw == _nw && k->no == _no && k->sw == _sw && k->so == _so) return k;
+	}
+	k = GOL_hl_eintragen(h);
+	k->nw = _nw;
+	k->no = _no;
+	k->sw = _sw;
+	k->so = _so;
+	k->lebende = _nw->lebende + _no->lebende + _sw->lebende + _so->lebende;
+	k->ebene = _nw->ebene + 1;
+	return k;
+}
+
+/**
+ * leerer Knoten der Ebene _ebene (>= 3)
+ */
+static GOL_knoten *GOL_hl_leer(int _ebene) {
+	GOL_knoten *e;
+	if (GOL_hl.leer[_ebene] == NULL) {
+		if (_ebene == 3) {
+			GOL_hl.leer[_ebene] = GOL_hl_blatt(0);
+		} else {
+			e = GOL_hl_leer(_ebene - 1);
+			GOL_hl.leer[_ebene] = GOL_hl_knoten(e, e, e, e);
+		}
+	}
+	return GOL_hl.leer[_ebene];
+}
+
+/**
+ * vier Blätter (nw, no, sw, so) zu 16 Zeilen mit je 16 Zellen (Bits 0 ... 15) zusammensetzen
+ * und umgekehrt die mittleren 8 x 8 Zellen (Zeilen und Spalten 4 ... 11) als Blatt entnehmen
+ */
+static void GOL_hl_16(const GOL_knoten *_nw, const GOL_knoten *_no, const GOL_knoten *_sw, const GOL_knoten *_so, uint64_t *_z) {
+	int r; // für Schleife
+	for (r = 0; r < 8; r++) {
+		_z[r] = ((_nw->bits >> (8 * r)) & 0xFF) | (((_no->bits >> (8 * r)) & 0xFF) << 8);
+		_z[r + 8] = ((_sw->bits >> (8 * r)) & 0xFF) | (((_so->bits >> (8 * r)) & 0xFF) << 8);
+	}
+}
+static GOL_knoten *GOL_hl_mitte_16(const uint64_t *_z) {
+	int r; // für Schleife
+	uint64_t bits = 0;
+	for (r = 0; r < 8; r++) bits |= ((_z[r + 4] >> 4) & 0xFF) << (8 * r);
+	return GOL_hl_blatt(bits);
+}
+
+/**
+ * Mitte eines Knotens (eine Ebene tiefer, ohne Zeitschritt)
+ */
+static GOL_knoten *GOL_hl_zentrum(GOL_knoten *_k) {
+	uint64_t z[16];
+	if (_k->ebene == 4) {
+		GOL_hl_16(_k->nw, _k->no, _k->sw, _k->so, z);
+		return GOL_hl_mitte_16(z);
+	}
+	return GOL_hl_knoten(_k->nw->so, _k->no->sw, _k->sw->no, _k->so->nw);
+}
+
+/**
+ * Mitte von _knoten (Ebene n) nach 2^_schritt Runden, _schritt <= n - 2
+ *
+ * Ebene 4 (16 x 16 Zellen) wird direkt mit dem Bit-Addierwerk gerechnet, darüber nach Gosper:
+ * aus den neun überlappenden Teilknoten der Ebene n - 1 entstehen neun Knoten der Ebene n - 2,
+ * beim vollen Sprung (_schritt = n - 2) bereits um die halbe Zeit weitergerechnet, sonst nur die Mitte.
+ * Vier daraus zusammengesetzte Knoten liefern dann die Viertel des Ergebnisses. Ergebnisse werden
+ * am Knoten gemerkt; da gleiche Teilbäume derselbe Knoten sind, wird jede Konstellation nur einmal gerechnet.
+ */
+GOL_knoten *GOL_hl_schritt(GOL_knoten *_knoten, int _schritt) {
+	int n = _knoten->ebene; // Ebene des Knotens
+	int r, g; // für Schleifen
+	int t; // Sprungweite der zweiten Hälfte
+	uint64_t z[16], neu[16]; // 16 x 16 Zellen für Ebene 4
+	GOL_knoten *k = _knoten, *e; // Kurzname und Ergebnis
+	GOL_knoten *n00, *n01, *n02, *n10, *n11, *n12, *n20, *n21, *n22; // neun Teilknoten
+	GOL_knoten *r00, *r01, *r02, *r10, *r11, *r12, *r20, *r21, *r22; // deren Mitten bzw. Ergebnisse
+
+	// schon gerechnet?
+	if (_schritt == n - 2 && k->ergebnis != NULL) return k->ergebnis;
+	if (_schritt < n - 2 && k->ergebnis_klein != NULL && k->schritt_klein == _schritt) return k->ergebnis_klein;
+
+	if (k->lebende == 0) {
+		// leere Fläche bleibt leer
+		e = GOL_hl_leer(n - 1);
+	} else if (n == 4) {
+		// 16 x 16 Zellen, aussen tot; nach höchstens 4 Runden sind die mittleren 8 x 8 Zellen noch exakt
+		GOL_hl_16(k->nw, k->no, k->sw, k->so, z);
+		for (g = 0; g < (1 << _schritt); g++) {
+			for (r = 0; r < 16; r++) {
+				neu[r] = GOL_wort(0, r > 0 ? z[r - 1] : 0, 0, 0, z[r], 0, 0, r < 15 ? z[r + 1] : 0, 0) & 0xFFFF;
+			}
+			memcpy(z, neu, sizeof(z));
+		}
+		e = GOL_hl_mitte_16(z);
+	} else {
+		n00 = k->nw;
+		n01 = GOL_hl_knoten(k->nw->no, k->no->nw, k->nw->so, k->no->sw);
+		n02 = k->no;
+		n10 = GOL_hl_knoten(k->nw->sw, k->nw->so, k->sw->nw, k->sw->no);
+		n11 = GOL_hl_knoten(k->nw->so, k->no->sw, k->sw->no, k->so->nw);
+		n12 = GOL_hl_knoten(k->no->sw, k->no->so, k->so->nw, k->so->no);
+		n20 = k->sw;
+		n21 = GOL_hl_knoten(k->sw->no, k->so->nw, k->sw->so, k->so->sw);
+		n22 = k->so;
+		if (_schritt == n - 2) {
+			// voller Sprung: erste Hälfte schon in den Teilknoten
+			t = n - 3;
+			r00 = GOL_hl_schritt(n00, t); r01 = GOL_hl_schritt(n01, t); r02 = GOL_hl_schritt(n02, t);
+			r10 = GOL_hl_schritt(n10, t); r11 = GOL_hl_schritt(n11, t); r12 = GOL_hl_schritt(n12, t);
+			r20 = GOL_hl_schritt(n20, t); r21 = GOL_hl_schritt(n21, t); r22 = GOL_hl_schritt(n22, t);
+		} else {
+			// kleinerer Sprung: nur die Mitten, die ganze Zeit in der zweiten Hälfte
+			t = _schritt;
+			r00 = GOL_hl_zentrum(n00); r01 = GOL_hl_zentrum(n01); r02 = GOL_hl_zentrum(n02);
+			r10 = GOL_hl_zentrum(n10); r11 = GOL_hl_zentrum(n11); r12 = GOL_hl_zentrum(n12);
+			r20 = GOL_hl_zentrum(n20); r21 = GOL_hl_zentrum(n21); r22 = GOL_hl_zentrum(n22);
+		}
+		e = GOL_hl_knoten(GOL_hl_schritt(GOL_hl_knoten(r00, r01, r10, r11), t), GOL_hl_schritt(GOL_hl_knoten(r01, r02, r11, r12), t),
+				GOL_hl_schritt(GOL_hl_knoten(r10, r11, r20, r21), t), GOL_hl_schritt(GOL_hl_knoten(r11, r12, r21, r22), t));
+	}
+
+	// Ergebnis merken
+	if (_schritt == n - 2) {
+		k->ergebnis = e;
+	} else {
+		k->ergebnis_klein = e;
+		k->schritt_klein = _schritt;
+	}
+	return e;
+}
+
+/**
+ * Knoten eine Ebene höher, _k liegt genau in der Mitte, aussen herum tot
+ */
+static GOL_knoten *GOL_hl_erweitern(GOL_knoten *_k) {
+	GOL_knoten *e = GOL_hl_leer(_k->ebene - 1);
+	return GOL_hl_knoten(GOL_hl_knoten(e, e, e, _k->nw), GOL_hl_knoten(e, e, _k->no, e), GOL_hl_knoten(e, _k->sw, e, e),
+			GOL_hl_knoten(_k->so, e, e, e));
+}
+
+/**
+ * Teilbaum mit linker oberer Ecke (_x, _y) aus dem bitweisen Spielfeld _feld (dim x dim) aufbauen
+ * und umgekehrt die lebenden Zellen in _feld eintragen; ausserhalb des Spielfelds ist alles tot
+ */
+static GOL_knoten *GOL_hl_aufbauen(uint64_t **_feld, int _dim, int _ebene, int _x, int _y) {
+	int r; // für Schleife
+	int halb = 1 << (_ebene - 1); // halbe Kantenlänge
+	uint64_t bits = 0;
+	if (_x >= _dim || _y >= _dim) return GOL_hl_leer(_ebene);
+	if (_ebene == 3) {
+		// 8 Zellen einer Zeile liegen immer im selben Wort (8 teilt 64)
+		for (r = 0; r < 8 && _y + r < _dim; r++) {
+			bits |= ((_feld[_y + r + 1][1 + _x / WORT_BITS] >> (_x % WORT_BITS)) & 0xFF) << (8 * r);
+		}
+		return GOL_hl_blatt(bits);
+	}
+	return GOL_hl_knoten(GOL_hl_aufbauen(_feld, _dim, _ebene - 1, _x, _y), GOL_hl_aufbauen(_feld, _dim, _ebene - 1, _x + halb, _y),
+			GOL_hl_aufbauen(_feld, _dim, _ebene - 1, _x, _y + halb), GOL_hl_aufbauen(_feld, _dim, _ebene - 1, _x + halb, _y + halb));
+}
+static void GOL_hl_auspacken(const GOL_knoten *_k, uint64_t **_feld, int _dim, int _x, int _y) {
+	int r; // für Schleife
+	int halb = 1 << (_k->ebene - 1); // halbe Kantenlänge
+	if (_k->lebende == 0 || _x >= _dim || _y >= _dim) return;
+	if (_k->ebene == 3) {
+		for (r = 0; r < 8 && _y + r < _dim; r++) {
+			_feld[_y + r + 1][1 + _x / WORT_BITS] |= ((_k->bits >> (8 * r)) & 0xFF) << (_x % WORT_BITS);
+		}
+		return;
+	}
+	GOL_hl_auspacken(_k->nw, _feld, _dim, _x, _y);
+	GOL_hl_auspacken(_k->no, _feld, _dim, _x + halb, _y);
+	GOL_hl_auspacken(_k->sw, _feld, _dim, _x, _y + halb);
+	GOL_hl_auspacken(_k->so, _feld, _dim, _x + halb, _y + halb);
+}
+
+/**
+ * alle Zellen ausserhalb des Spielfelds (dim x dim) töten
+ * nur Knoten auf dem Spielfeldrand werden neu angelegt, alle anderen bleiben unverändert
+ */
+static GOL_knoten *GOL_hl_beschneiden(GOL_knoten *_k, int _dim, int _x, int _y) {
+	int r; // für Schleife
+	int kante = 1 << _k->ebene, halb = kante / 2; // Kantenlänge
+	uint64_t bits = 0, spalten;
+	if (_k->lebende == 0 || (_x + kante <= _dim && _y + kante <= _dim)) return _k;
+	if (_x >= _dim || _y >= _dim) return GOL_hl_leer(_k->ebene);
+	if (_k->ebene == 3) {
+		spalten = (_dim - _x >= 8) ? 0xFF : ((uint64_t) 1 << (_dim - _x)) - 1;
+		for (r = 0; r < 8 && _y + r < _dim; r++) bits |= _k->bits & (spalten << (8 * r));
+		return GOL_hl_blatt(bits);
+	}
+	return GOL_hl_knoten(GOL_hl_beschneiden(_k->nw, _dim, _x, _y), GOL_hl_beschneiden(_k->no, _dim, _x + halb, _y),
+			GOL_hl_beschneiden(_k->sw, _dim, _x, _y + halb), GOL_hl_beschneiden(_k->so, _dim, _x + halb, _y + halb));
+}
+
+/**
+ * Gibt es lebende Zellen in einem Streifen der Breite _breite innen am Spielfeldrand?
+ * Wenn nicht, kann sich in 2^n <= _breite Runden keine Zelle ausserhalb des Spielfelds beleben und
+ * der Sprung in der unbegrenzten Ebene ist exakt gleich dem Spielfeld mit totem Rand.
+ */
+static int GOL_hl_rand_belebt(const GOL_knoten *_k, int _dim, int _breite, int _x, int _y) {
+	int r, c; // für Schleifen
+	int kante = 1 << _k->ebene, halb = kante / 2; // Kantenlänge
+	if (_k->lebende == 0) return 0;
+	if (_x >= _breite && _y >= _breite && _x + kante <= _dim - _breite && _y + kante <= _dim - _breite) return 0;
+	if (_k->ebene == 3) {
+		for (r = 0; r < 8; r++) {
+			for (c = 0; c < 8; c++) {
+				if (((_k->bits >> (8 * r + c)) & 1)
+						&& (_x + c < _breite || _y + r < _breite || _x + c >= _dim - _breite || _y + r >= _dim - _breite)) return 1;
+			}
+		}
+		return 0;
+	}
+	return GOL_hl_rand_belebt(_k->nw, _dim, _breite, _x, _y) || GOL_hl_rand_belebt(_k->no, _dim, _breite, _x + halb, _y)
+			|| GOL_hl_rand_belebt(_k->sw, _dim, _breite, _x, _y + halb) || GOL_hl_rand_belebt(_k->so, _dim, _breite, _x + halb, _y + halb);
+}
+
+/**
+ * Speicherbereinigung: Markieren aller von der Wurzel und den leeren Knoten aus erreichbaren Knoten,
+ * gemerkte Ergebnisse auf nicht erreichbare Knoten werden vergessen, der Rest freigegeben
+ */
+static void GOL_hl_markieren(GOL_knoten *_k) {
+	if (_k == NULL || _k->markiert) return;
+	_k->markiert = 1;
+	if (_k->nw != NULL) {
+		GOL_hl_markieren(_k->nw);
+		GOL_hl_markieren(_k->no);
+		GOL_hl_markieren(_k->sw);
+		GOL_hl_markieren(_k->so);
+	}
+}
+void GOL_hl_aufraeumen(GOL_knoten *_wurzel) {
+	size_t i;
+	int e;
+	GOL_knoten *k, **vor;
+
+	GOL_hl_markieren(_wurzel);
+	for (e = 0; e < 64; e++) GOL_hl_markieren(GOL_hl.leer[e]);
+
+	// gemerkte Ergebnisse der überlebenden Knoten prüfen (vor dem Freigeben, die Markierung muss noch lesbar sein)
+	for (i = 0; i < GOL_hl.groesse; i++) {
+		for (k = GOL_hl.zeilen[i]; k != NULL; k = k->kette) {
+			if (!k->markiert) continue;
+			if (k->ergebnis != NULL && !k->ergebnis->markiert) k->ergebnis = NULL;
+			if (k->ergebnis_klein != NULL && !k->ergebnis_klein->markiert) k->ergebnis_klein = NULL;
+		}
+	}
+	// nicht markierte Knoten freigeben, Markierung zurücksetzen
+	for (i = 0; i < GOL_hl.groesse; i++) {
+		vor = &GOL_hl.zeilen[i];
+		while ((k = *vor) != NULL) {
+			if (k->markiert) {
+				k->markiert = 0;
+				vor = &k->kette;
+			} else {
+				*vor = k->kette;
+				free(k);
+				GOL_hl.knoten--;
+			}
+		}
+	}
+}
+
+/**
+ * Hashlife-Variante von "Game Of Life" (nur ROOT)
+ *
+ * Anfangsbedingungen wie in GOL_seriell, danach wird das Spielfeld als Quadtree gespeichert.
+ * Jeder Sprung geht bis zur nächsten Runde, in der das Vollspielfeld gebraucht wird (GOL_voll_noetig),
+ * höchstens aber 2^n Runden, solange innen am Rand ein Streifen der Breite 2^n leer ist. Berührt das Muster
+ * den Rand, wird Runde für Runde gerechnet und ausserhalb des Spielfelds beschnitten.
+ */
+double GOL_hashlife(int spielfeld_dim, int _runden, int _speed, int _scr_h, int _cell_h) {
+	// Variablen
+	int runde = optionen.start_runde, ziel = 0; // aktuelle Runde und nächste Runde mit Ausgabe bzw. Sicherung
+	int ebene; // Ebene der Wurzel, Kantenlänge 2^ebene >= dim
+	int sprung; // Sprungweite log2
+	int bereinigungen = 0; // Anzahl der Speicherbereinigungen
+	int worte = GOL_worte(spielfeld_dim) + 2; // Worte pro Zeile inkl. linkes und rechtes Randwort
+	uint64_t **voll_spielfeld = NULL; // für die Ausgabe
+	GOL_knoten *wurzel; // das Spielfeld als Quadtree
+	GOL_sicherung sicherung = GOL_SICHERUNG_LEER; // Sicherung, die im Hintergrund geschrieben wird
+	int signal_behandelt = 0; // Anzahl der schon gesicherten Signale
+	double proc_zeit; // für Rechenzeitberechnung
+
+	// Vollspielfeld für Anfangsbedingungen und Ausgabe
+	voll_spielfeld = malloc2D_bits(spielfeld_dim + 2, worte);
+
+	// Initialisierung des Spielfelds mit Werten, entspricht Anfangsbedingungen (gleiche Reihenfolge wie GOL_seriell)
+	if (optionen.fortsetzen[0] != '\0') {
+		if (GOL_sicherung_laden(optionen.fortsetzen, MPI_COMM_SELF, voll_spielfeld, 1, worte, spielfeld_dim, 0, spielfeld_dim, 0, worte - 2) != 0)
+			printf("Error: Sicherung %s kann nicht gelesen werden\n", optionen.fortsetzen);
+	} else if (optionen.muster[0] == '\0' || GOL_muster_laden(optionen.muster, MPI_COMM_SELF, spielfeld_dim, voll_spielfeld, 1, 0, spielfeld_dim, 0,
+			spielfeld_dim) != 0) {
+		// Zufallswerte: dasselbe Spielfeld wie GOL_seriell und GOL_parallel
+		GOL_zufall_fuellen(voll_spielfeld, NULL, 1, spielfeld_dim, worte - 2, spielfeld_dim, 0, 0);
+	}
+
+	// Startzeit speichern
+	proc_zeit = MPI_Wtime();
+
+	// Hashtabelle anlegen, Speichergrenze in Knoten umrechnen
+	GOL_hl_tabelle(1 << 16);
+	GOL_hl.grenze = ((size_t) optionen.hl_speicher << 20) / (sizeof(GOL_knoten) + 2 * sizeof(GOL_knoten *));
+
+	for (ebene = 4; (1 << ebene) < spielfeld_dim; ebene++);
+	wurzel = GOL_hl_aufbauen(voll_spielfeld, spielfeld_dim, ebene, 0, 0);
+
+	while (runde < _runden) {
+		// nächste Runde, in der das Vollspielfeld gebraucht bzw. gesichert wird
+		if (runde >= ziel) {
+			for (ziel = runde + 1; !GOL_voll_noetig(ziel, _runden) && !GOL_sicherung_faellig(ziel); ziel++);
+		}
+
+		// größter Sprung bis zum Ziel, der nicht über den toten Rand hinaus wirken kann
+		for (sprung = 0; sprung < ebene - 1 && (2 << sprung) <= ziel - runde; sprung++);
+		while (sprung > 0 && GOL_hl_rand_belebt(wurzel, spielfeld_dim, 1 << sprung, 0, 0)) sprung--;
+
+		// Wurzel mit totem Rand erweitern, damit die Mitte nach dem Sprung wieder das ganze Spielfeld ist
+		wurzel = GOL_hl_schritt(GOL_hl_erweitern(wurzel), sprung);
+		if (sprung == 0) wurzel = GOL_hl_beschneiden(wurzel, spielfeld_dim, 0, 0);
+		runde += 1 << sprung;
+
+		// unerreichbare Knoten freigeben; bleibt zu viel übrig, wird die Grenze angehoben
+		if (GOL_hl.knoten > GOL_hl.grenze) {
+			GOL_hl_aufraeumen(wurzel);
+			bereinigungen++;
+			if (GOL_hl.knoten > GOL_hl.grenze / 2) {
+				printf("Hashlife: Speichergrenze zu klein, %zu Knoten noch erreichbar\n", GOL_hl.knoten);
+				GOL_hl.grenze = 2 * GOL_hl.knoten;
+			}
+		}
+
+		// Grafische Ausgabe, Schnappschuss bzw. Ergebnis der letzten Runde; Sicherung regelmäßig oder auf ein Signal
+		if (runde == ziel || GOL_signal > signal_behandelt) {
+			memset(voll_spielfeld[0], 0, (size_t) (spielfeld_dim + 2) * worte * sizeof(uint64_t));
+			GOL_hl_auspacken(wurzel, voll_spielfeld, spielfeld_dim, 0, 0);
+			if (runde == ziel && GOL_voll_noetig(runde, _runden)) GOL_voll_ausgeben(voll_spielfeld, spielfeld_dim, runde, _runden, _speed);
+			if (optionen.sicherung != 0 && (GOL_signal > signal_behandelt || GOL_sicherung_faellig(runde)))
+				GOL_sicherung_schreiben(&sicherung, MPI_COMM_SELF, voll_spielfeld, 1, spielfeld_dim, 0, spielfeld_dim, 0, worte - 2, runde);
+			signal_behandelt = GOL_signal;
+			if (GOL_signal_ende) {
+				printf("Auf Signal nach Runde %d beendet, fortsetzen mit -fortsetzen %s\n", runde, optionen.sicherung_datei);
+				break;
+			}
 		}
 	}
+	GOL_sicherung_abschliessen(&sicherung);
 
 	// Rechnezeit berechnen und in max_zeit speichern
 	proc_zeit = MPI_Wtime() - proc_zeit;
+	printf("Hashlife: %zu Knoten, %d Speicherbereinigungen\n", GOL_hl.knoten, bereinigungen);
+
+	// Speicher freigeben: alle Knoten (ohne Wurzel bleibt nichts erreichbar) und die Tabelle
+	memset(GOL_hl.leer, 0, sizeof(GOL_hl.leer));
+	GOL_hl_aufraeumen(NULL);
+	free(GOL_hl.zeilen);
+	GOL_hl.zeilen = NULL;
+	GOL_hl.groesse = 0;
+	free2D_bits(voll_spielfeld);
+
+	// gesamte Rechenzeit zurückgeben
+	return (proc_zeit);
+}
+
+#if GOL_MMAP
+/**
+ * Schreibt _n Bytes an die Stelle _pos der Datei _fd (pwrite schreibt evtl. weniger auf einmal), -1 = Fehler
+ */
+static int GOL_datei_schreiben(int _fd, const void *_daten, size_t _n, off_t _pos) {
+	const char *p = (const char *) _daten; // noch nicht geschriebene Bytes
+	ssize_t n; // geschriebene Bytes
+	while (_n > 0) {
+		if ((n = pwrite(_fd, p, _n, _pos)) <= 0) return -1;
+		p += n;
+		_pos += n;
+		_n -= (size_t) n;
+	}
+	return 0;
+}
+
+/**
+ * Zeilen 1 ... _zeilen von _feld ohne Randworte in _puffer packen und als Spielfeldzeilen ab _z_von in die Datei schreiben
+ */
+static int GOL_datei_band_schreiben(int _fd, uint64_t **_feld, uint64_t *_puffer, int _z_von, int _zeilen, int _nw) {
+	int i; // für Schleife
+	for (i = 0; i < _zeilen; i++)
+		memcpy(&_puffer[(size_t) i * _nw], &_feld[1 + i][1], _nw * sizeof(uint64_t));
+	return GOL_datei_schreiben(_fd, _puffer, (size_t) _zeilen * _nw * sizeof(uint64_t),
+			GOL_SICHERUNG_KOPF + (off_t) _z_von * _nw * sizeof(uint64_t));
+}
+
+/**
+ * Hinweis _hinweis (madvise) für die Bytes [_von, _bis) einer abgebildeten Datei; madvise verlangt einen Seitenanfang
+ */
+static void GOL_datei_hinweis(const unsigned char *_abbild, size_t _von, size_t _bis, int _hinweis) {
+	size_t seite = (size_t) sysconf(_SC_PAGESIZE); // Seitengröße
+	_von -= _von % seite;
+	if (_bis > _von) madvise((void *) (_abbild + _von), _bis - _von, _hinweis);
+}
+
+/**
+ * Zeigen zwei Deskriptoren auf dieselbe Datei?
+ */
+static int GOL_datei_gleich(int _fd1, int _fd2) {
+	struct stat a, b; // Dateiinfos
+	if (_fd1 < 0 || _fd2 < 0 || fstat(_fd1, &a) != 0 || fstat(_fd2, &b) != 0) return 0;
+	return a.st_dev == b.st_dev && a.st_ino == b.st_ino;
+}
+#endif
+
+double GOL_datei(int spielfeld_dim, int _runden) {
+#if GOL_MMAP
+	// Variablen
+	int k, i; // für diverse Schleifen
+	int runde = optionen.start_runde; // zuletzt vollständig geschriebene Runde
+	int q = 0, z = 0; // Datei mit der aktuellen bzw. der nächsten Generation (2 = Sicherung, aus der fortgesetzt wird)
+	int nw = GOL_worte(spielfeld_dim); // Worte pro Zeile in der Datei (ohne Randworte)
+	int worte = nw + 2; // Worte pro Zeile im Fenster inkl. linkes und rechtes Randwort
+	uint64_t maske = GOL_maske(spielfeld_dim); // gültige Bits im letzten Wort einer Zeile
+	size_t zeile_bytes = (size_t) nw * sizeof(uint64_t); // Bytes pro Zeile in der Datei
+	size_t groesse = GOL_SICHERUNG_KOPF + (size_t) spielfeld_dim * zeile_bytes; // Bytes pro Datei
+	int band; // Zeilen pro Band
+	int z_von, z_anzahl, zeile; // aktuelles Band (Spielfeldzeilen ab 0), Spielfeldzeile einer Fensterzeile
+	int muster; // Anfangsbedingungen aus der Musterdatei
+	GOL_muster_baender muster_baender; // ... bandweise gelesen
+	char name[3][300]; // Spielfelddateien
+	int fd[3] = { -1, -1, -1 }; // ... ihre Deskriptoren
+	const unsigned char *abbild[3] = { NULL, NULL, NULL }; // ... und ihre Abbildung im Speicher (nur lesend)
+	long long kopf[GOL_SICHERUNG_KOPF / sizeof(long long)]; // Kopf der Dateien
+	long long lebende = 0; // lebende Zellen der letzten Runde
+	uint64_t **fenster, **neu; // Band der aktuellen Generation samt Nachbarzeilen bzw. seine nächste Generation
+	uint64_t *puffer; // nächste Generation des Bands ohne Randworte, wie in der Datei
+	FILE *bild = NULL; // Schnappschuss der laufenden Runde
+	char bild_name[64]; // ... sein Name
+	unsigned char *bild_zeile; // ... und eine Bildzeile
+	int fehler = 0; // Datei nicht lesbar bzw. nicht schreibbar
+	double proc_zeit = 0; // für Rechenzeitberechnung
+
+	// so viele Zeilen pro Band, dass Fenster, nächste Generation und Puffer in optionen.datei_fenster MB passen
+	band = (int) (((size_t) optionen.datei_fenster << 20) / ((2 * (size_t) worte + nw) * sizeof(uint64_t)));
+	if (band < 1) band = 1;
+	if (band > spielfeld_dim) band = spielfeld_dim;
+	fenster = malloc2D_bits(band + 2, worte);
+	neu = malloc2D_bits(band + 2, worte);
+	puffer = (uint64_t *) malloc((size_t) band * zeile_bytes);
+	bild_zeile = (unsigned char *) malloc((spielfeld_dim + 7) / 8);
+	if (optionen.ausgabe) printf("Datei: %d Zeilen pro Band, Fenster %.1f MB\n", band, (2.0 * (band + 2) * worte + (double) band * nw) * 8 / (1 << 20));
+
+	// beide Spielfelddateien in voller Größe anlegen, dazu ggf. die Sicherung, aus der fortgesetzt wird; alle nur lesend abbilden
+	for (i = 0; i < 2; i++) {
+		snprintf(name[i], sizeof(name[i]), "%s_%d.bin", optionen.datei_praefix, i);
+		if ((fd[i] = open(name[i], O_RDWR | O_CREAT, 0644)) < 0 || ftruncate(fd[i], (off_t) groesse) != 0) {
+			printf("Error: %s kann nicht angelegt werden\n", name[i]);
+			fehler = 1;
+		}
+	}
+	if (optionen.fortsetzen[0] != '\0') {
+		snprintf(name[2], sizeof(name[2]), "%s", optionen.fortsetzen);
+		if ((fd[2] = open(name[2], O_RDONLY)) < 0) {
+			printf("Error: Sicherung %s kann nicht gelesen werden\n", name[2]);
+			fehler = 1;
+		}
+		q = 2;
+	}
+	for (i = 0; i < 3 && !fehler; i++) {
+		if (fd[i] < 0) continue;
+		abbild[i] = (const unsigned char *) mmap(NULL, groesse, PROT_READ, MAP_SHARED, fd[i], 0);
+		if (abbild[i] == (const unsigned char *) MAP_FAILED) {
+			printf("Error: %s kann nicht in den Speicher abgebildet werden\n", name[i]);
+			abbild[i] = NULL;
+			fehler = 1;
+		} else {
+			madvise((void *) abbild[i], groesse, MADV_SEQUENTIAL); // jede Runde liest die Datei einmal von vorn nach hinten
+		}
+	}
+
+	// Initialisierung der ersten Datei mit Werten, entspricht Anfangsbedingungen (gleiche Reihenfolge wie GOL_seriell);
+	// beim Fortsetzen wird direkt aus der Sicherung gelesen
+	// (Musterdatei nicht lesbar: Zufallswerte wie dort; bricht das Lesen mitten im Muster ab, wird nicht gerechnet)
+	if (q == 0 && !fehler) {
+		memset(kopf, 0, sizeof(kopf));
+		fehler = GOL_datei_schreiben(fd[0], kopf, sizeof(kopf), 0) != 0;
+		muster = optionen.muster[0] != '\0' && GOL_muster_baender_oeffnen(&muster_baender, optionen.muster, spielfeld_dim) == 0;
+		for (z_von = 0; z_von < spielfeld_dim && !fehler; z_von += band) {
+			z_anzahl = (spielfeld_dim - z_von < band) ? spielfeld_dim - z_von : band;
+			memset(neu[0], 0, (size_t) (band + 2) * worte * sizeof(uint64_t));
+			if (!muster) {
+				GOL_zufall_fuellen(neu, NULL, 1, z_anzahl, nw, spielfeld_dim, z_von, 0);
+			} else if (GOL_muster_band(&muster_baender, neu, 1, z_von, z_anzahl, spielfeld_dim) != 0) {
+				printf("Error: Muster %s kann ab Spielfeldzeile %d nicht gelesen werden\n", optionen.muster, z_von);
+				fehler = 1;
+				break;
+			}
+			if (GOL_datei_band_schreiben(fd[0], neu, puffer, z_von, z_anzahl, nw) != 0) {
+				printf("Error: %s kann nicht geschrieben werden\n", name[0]);
+				fehler = 1;
+			}
+		}
+		if (muster) GOL_muster_baender_schliessen(&muster_baender);
+		GOL_sicherung_kopf_setzen(kopf, spielfeld_dim, runde);
+		if (!fehler && GOL_datei_schreiben(fd[0], kopf, sizeof(kopf), 0) != 0) {
+			printf("Error: %s kann nicht geschrieben werden\n", name[0]);
+			fehler = 1;
+		}
+	}
+
+	// Startzeit speichern
+	proc_zeit = MPI_Wtime();
+
+	// Spiel "_runden-Mal" spielen, jede Runde bandweise von der Datei q in die Datei z
+	for (k = optionen.start_runde; k < _runden && !fehler; k++) {
+		z = (q == 0 || (q == 2 && GOL_datei_gleich(fd[2], fd[0]))) ? 1 : 0;
+
+		// bis die Runde vollständig geschrieben ist, ist die Zieldatei keine gültige Sicherung
+		memset(kopf, 0, sizeof(kopf));
+		fehler = GOL_datei_schreiben(fd[z], kopf, sizeof(kopf), 0) != 0;
+		if (optionen.schnappschuss > 0 && (k + 1) % optionen.schnappschuss == 0) {
+			snprintf(bild_name, sizeof(bild_name), "gol_%06d.pbm", k + 1);
+			if ((bild = fopen(bild_name, "wb")) == NULL) printf("Error: %s kann nicht geschrieben werden\n", bild_name);
+			else fprintf(bild, "P4\n%d %d\n", spielfeld_dim, spielfeld_dim);
+		}
+		lebende = 0;
+
+		for (z_von = 0; z_von < spielfeld_dim && !fehler; z_von += band) {
+			z_anzahl = (spielfeld_dim - z_von < band) ? spielfeld_dim - z_von : band;
+
+			// nächstes Band schon anfordern, das Betriebssystem liest es, während dieses Band gerechnet wird
+			if (z_von + z_anzahl < spielfeld_dim)
+				GOL_datei_hinweis(abbild[q], GOL_SICHERUNG_KOPF + (z_von + z_anzahl) * zeile_bytes,
+						GOL_SICHERUNG_KOPF + ((z_von + z_anzahl + band < spielfeld_dim) ? z_von + z_anzahl + band : spielfeld_dim) * zeile_bytes,
+						MADV_WILLNEED);
+
+			// Fenster: Spielfeldzeilen z_von - 1 ... z_von + z_anzahl mit Randworten; ausserhalb des Spielfelds tot bzw. Torus
+			for (i = 0; i < z_anzahl + 2; i++) {
+				zeile = z_von - 1 + i;
+				if (optionen.torus) zeile = (zeile + spielfeld_dim) % spielfeld_dim;
+				if (zeile < 0 || zeile >= spielfeld_dim) memset(fenster[i], 0, worte * sizeof(uint64_t));
+				else memcpy(&fenster[i][1], abbild[q] + GOL_SICHERUNG_KOPF + zeile * zeile_bytes, zeile_bytes);
+			}
+			if (optionen.torus) GOL_torus_naehen(fenster, 0, z_anzahl + 2, nw, spielfeld_dim);
+
+			// nächste Generation des Bands mit dem Bit-Addierwerk, die Zeilen auf die Threads verteilt
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+			for (i = 1; i <= z_anzahl; i++)
+				GOL_block(fenster, neu, i, i + 1, 1, worte - 1, worte, maske, 0);
+
+			// in die Zieldatei schreiben (zunächst in den Seitencache) und das Zurückschreiben sofort anstoßen (write-behind);
+			// gelesene Zeilen bis auf die letzte (obere Nachbarzeile des nächsten Bands) braucht diese Runde nicht mehr,
+			// die nächste überschreibt sie: aus dem Speicher des Procs und aus dem Seitencache entlassen
+			fehler = GOL_datei_band_schreiben(fd[z], neu, puffer, z_von, z_anzahl, nw) != 0;
+			posix_fadvise(fd[z], GOL_SICHERUNG_KOPF + (off_t) z_von * zeile_bytes, (off_t) z_anzahl * zeile_bytes, POSIX_FADV_DONTNEED);
+			zeile = (z_von > 0) ? z_von - 1 : 0;
+			GOL_datei_hinweis(abbild[q], GOL_SICHERUNG_KOPF + zeile * zeile_bytes, GOL_SICHERUNG_KOPF + (z_von + z_anzahl - 1) * zeile_bytes,
+					MADV_DONTNEED);
+			posix_fadvise(fd[q], GOL_SICHERUNG_KOPF + (off_t) zeile * zeile_bytes, (off_t) (z_von + z_anzahl - 1 - zeile) * zeile_bytes,
+					POSIX_FADV_DONTNEED);
+
+			// Schnappschuss bzw. Ergebnis der letzten Runde bandweise
+			if (bild != NULL) GOL_pbm_zeilen(bild, neu, 1, z_anzahl + 1, spielfeld_dim, bild_zeile);
+			if (k + 1 == _runden) {
+				lebende += GOL_lebende(neu, z_anzahl, nw);
+				if (GOL_ergebnis != NULL) {
+					for (i = 1; i <= z_anzahl; i++)
+						memcpy(&GOL_ergebnis[z_von + i][1], &neu[i][1], zeile_bytes);
+				}
+			}
+		}
+		if (bild != NULL) {
+			fclose(bild);
+			bild = NULL;
+		}
+
+		// Runde vollständig: mit dem Kopf wird die Zieldatei zur gültigen Sicherung der Runde k + 1
+		GOL_sicherung_kopf_setzen(kopf, spielfeld_dim, k + 1);
+		if (fehler || GOL_datei_schreiben(fd[z], kopf, sizeof(kopf), 0) != 0) {
+			printf("Error: %s kann nicht geschrieben werden\n", name[z]);
+			fehler = 1;
+			break;
+		}
+		q = z;
+		runde = k + 1;
+		if (runde == _runden && optionen.ausgabe && GOL_ergebnis == NULL) printf("Lebende Zellen nach %d Runden: %lld\n", runde, lebende);
+		if (GOL_signal_ende) {
+			printf("Auf Signal nach Runde %d beendet, fortsetzen mit -fortsetzen %s\n", runde, name[q]);
+			break;
+		}
+	}
+
+	// Rechnezeit berechnen
+	proc_zeit = MPI_Wtime() - proc_zeit;
+
+	// die ältere Datei wird nicht mehr gebraucht (ausser sie ist die Sicherung, aus der fortgesetzt wurde)
+	if (!fehler && q != 2) {
+		if (optionen.ausgabe) printf("Spielfeld der Runde %d in %s, fortsetzen mit -fortsetzen %s\n", runde, name[q], name[q]);
+		if (!GOL_datei_gleich(fd[1 - q], fd[2])) unlink(name[1 - q]);
+	}
+
+	// Abbildungen, Dateien und Speicher freigeben
+	for (i = 0; i < 3; i++) {
+		if (abbild[i] != NULL) munmap((void *) abbild[i], groesse);
+		if (fd[i] >= 0) close(fd[i]);
+	}
+	free2D_bits(fenster);
+	free2D_bits(neu);
+	free(puffer);
+	free(bild_zeile);
 
 	// gesamte Rechenzeit zurückgeben
 	return (proc_zeit);
+#else
+	printf("Error: -engine datei gibt es nur unter POSIX\n");
+	return 0;
+#endif
 }
 
 /**
  * Initialisierung SDL, Bildschirmfenster und Module
+ * Passt das Spielfeld nicht mit _cell_h Pixeln pro Zelle auf den Bildschirm, wird die Zelle kleiner,
+ * bei mehr Zellen als Pixeln fasst ein Pixel einen Block von Zellen zusammen
  */
-void SDL_init(int _dim, int _cell_h) {
+void SDL_init(int _dim, int _scr_h, int _cell_h) {
+	int i, g; // für Schleifen, Helligkeit
+
 	// Video-Funktion initialisieren
 	if (SDL_Init(SDL_INIT_VIDEO) < 0) {
 		printf("Error: %s\n", SDL_GetError());
@@ -497,47 +5042,175 @@ void SDL_init(int _dim, int _cell_h) {
 	}
 	atexit(SDL_Quit);
 
-	// Bildschirmsurface initialisieren
-	screen = SDL_SetVideoMode(_dim * _cell_h, _dim * _cell_h, 32, SDL_HWSURFACE | SDL_DOUBLEBUF);
+	// Größe der Bildpunkte
+	anzeige.faktor = 1;
+	anzeige.pixel = _cell_h;
+	if (_dim * _cell_h > _scr_h) {
+		anzeige.pixel = (_scr_h / _dim > 1) ? _scr_h / _dim : 1;
+		if (_dim > _scr_h) anzeige.faktor = (_dim + _scr_h - 1) / _scr_h;
+	}
+	anzeige.n = (_dim + anzeige.faktor - 1) / anzeige.faktor;
+
+	// Bildschirmsurface initialisieren (im Hauptspeicher, der Renderthread schreibt direkt in die Pixel)
+	screen = SDL_SetVideoMode(anzeige.n * anzeige.pixel, anzeige.n * anzeige.pixel, 32, SDL_SWSURFACE);
 	if (screen == NULL) {
 		printf("Error: %s\n", SDL_GetError());
 		exit(2);
 	}
 	SDL_WM_SetCaption("Game Of Life [von Denis Maus und Yevgeniy Ruts]", NULL); // Fenstertitel setzen
+	if (anzeige.faktor > 1) printf("Demofenster verkleinert: %d x %d Zellen pro Pixel\n", anzeige.faktor, anzeige.faktor);
 
-	cell.w = cell.h = _cell_h; // Größe einer Zelle difinieren (quadratisch)
 	bgColor = SDL_MapRGB(screen->format, 0, 0, 0); // Farbe für Zelle setzen = schwarz
 	cellColorLife = SDL_MapRGB(screen->format, 255, 0, 0); // Farbe für Zelle setzen = rot
+	// Farben der Dichten von schwarz nach rot, Helligkeit = Wurzel der Dichte (einzelne Zellen in großen Blöcken bleiben sichtbar)
+	for (i = 0; i < 256; i++) {
+		for (g = 0; (g + 1) * (g + 1) <= i * 255; g++)
+			;
+		anzeige.farbe[i] = SDL_MapRGB(screen->format, (Uint8) g, 0, 0);
+	}
+
+	// Bildpuffer und Renderthread
+	for (i = 0; i < 3; i++)
+		anzeige.bild[i] = (Uint8 *) calloc((size_t) anzeige.n * anzeige.n, 1);
+	anzeige.summe = (unsigned int *) malloc(anzeige.n * sizeof(unsigned int));
+	anzeige.neu = anzeige.ende = 0;
+	anzeige.mutex = SDL_CreateMutex();
+	anzeige.cond = SDL_CreateCond();
+	anzeige.thread = SDL_CreateThread(GOL_gfx_zeichnen, &anzeige);
+	if (anzeige.thread == NULL) {
+		printf("Error: %s\n", SDL_GetError());
+		exit(3);
+	}
 }
 
 /**
- * Grafische Ausgabe des Spielfeldes mit SDL
+ * Zählt die lebenden Zellen _von ... _bis - 1 (ab 0) einer Spielfeldzeile (Wort 0 ist das linke Randwort)
  */
-void GOL_gfx(int **spielfeld, int _dim) {
-	// Spielfeld mit Anfangsbedingungen initialisieren
-	int i, j; // für Schleife
+static unsigned int GOL_zellen_zaehlen(const uint64_t *_zeile, int _von, int _bis) {
+	int w; // für Schleife
+	unsigned int n = 0; // Anzahl
+	uint64_t maske; // Zellen des Bereichs im Wort
+
+	for (w = _von / WORT_BITS; w <= (_bis - 1) / WORT_BITS; w++) {
+		maske = ~(uint64_t) 0;
+		if (w == _von / WORT_BITS) maske &= ~(uint64_t) 0 << (_von % WORT_BITS);
+		if (w == (_bis - 1) / WORT_BITS && _bis % WORT_BITS != 0) maske &= ~(~(uint64_t) 0 << (_bis % WORT_BITS));
+		n += GOL_POPCOUNT(_zeile[1 + w] & maske);
+	}
+	return n;
+}
 
-	// Hintergrundfarbe füllen
-	SDL_FillRect(screen, NULL, bgColor);
+/**
+ * Grafische Ausgabe des Spielfeldes mit SDL
+ * Dichtebild in den eigenen Puffer rechnen (Popcount über Blöcke von faktor x faktor Zellen), dann gegen das
+ * bereitliegende Bild tauschen und den Renderthread wecken; gezeichnet wird dort, die Simulation rechnet weiter
+ */
+void GOL_gfx(uint64_t **spielfeld, int _dim, int _speed) {
+	int y, x, i; // für Schleifen
+	int z_von, z_bis, s_von, s_bis; // Zellen eines Bildpunkts
+	int f = anzeige.faktor, n = anzeige.n;
+	Uint8 *bild = anzeige.bild[GOL_BILD_SIM], *tausch;
 
-	// Spielfeld zeichnen (lebende Zellen aufzeigen)
-	for (i = 1; i < _dim; i++) {
-		cell.y = (i - 1) * cell.h;
-		for (j = 1; j < _dim; j++) {
-			cell.x = (j - 1) * cell.w;
-			if (spielfeld[i][j] == 1) {
-				SDL_FillRect(screen, &cell, cellColorLife);
+	for (y = 0; y < n; y++) {
+		if (f == 1) {
+			// ein Bildpunkt je Zelle
+			for (x = 0; x < n; x++)
+				bild[y * n + x] = ZELLE(spielfeld[y + 1], x + 1) ? 255 : 0;
+			continue;
+		}
+		z_von = y * f;
+		z_bis = (z_von + f < _dim) ? z_von + f : _dim;
+		memset(anzeige.summe, 0, n * sizeof(unsigned int));
+		for (i = z_von; i < z_bis; i++) {
+			for (x = 0; x < n; x++) {
+				s_von = x * f;
+				s_bis = (s_von + f < _dim) ? s_von + f : _dim;
+				anzeige.summe[x] += GOL_zellen_zaehlen(spielfeld[i + 1], s_von, s_bis);
 			}
 		}
+		for (x = 0; x < n; x++) {
+			s_bis = (x * f + f < _dim) ? x * f + f : _dim;
+			bild[y * n + x] = (Uint8) (255u * anzeige.summe[x] / ((z_bis - z_von) * (s_bis - x * f)));
+		}
 	}
 
-	// Spielfeld zum Bildschirm "schicken"
-	SDL_Flip(screen);
+	// fertiges Bild übergeben
+	SDL_LockMutex(anzeige.mutex);
+	tausch = anzeige.bild[GOL_BILD_BEREIT];
+	anzeige.bild[GOL_BILD_BEREIT] = bild;
+	anzeige.bild[GOL_BILD_SIM] = tausch;
+	anzeige.neu = 1;
+	anzeige.speed = _speed;
+	SDL_CondSignal(anzeige.cond);
+	SDL_UnlockMutex(anzeige.mutex);
+}
+
+/**
+ * Renderthread: holt das neueste Bild, schreibt es Zeile für Zeile in die Pixel des Fensters
+ * (jede Pixelzeile eines Bildpunkts nach der ersten ist eine Kopie) und wartet danach speed Mikrosekunden
+ * Endet, wenn ende gesetzt ist und kein Bild mehr bereitliegt (das letzte Bild wird also noch gezeichnet)
+ */
+int GOL_gfx_zeichnen(void *_daten) {
+	GOL_anzeige *a = (GOL_anzeige *) _daten;
+	int y, x, r, c; // für Schleifen
+	int speed; // Pause nach diesem Bild
+	int breite = a->n * a->pixel; // Pixel pro Zeile
+	Uint8 *bild, *tausch; // zu zeichnendes Bild
+	Uint32 *zeile, farbe; // Pixelzeile, Farbe eines Bildpunkts
+
+	for (;;) {
+		SDL_LockMutex(a->mutex);
+		while (!a->neu && !a->ende)
+			SDL_CondWait(a->cond, a->mutex);
+		if (!a->neu) {
+			SDL_UnlockMutex(a->mutex);
+			break;
+		}
+		tausch = a->bild[GOL_BILD_ZEICHNEN];
+		a->bild[GOL_BILD_ZEICHNEN] = a->bild[GOL_BILD_BEREIT];
+		a->bild[GOL_BILD_BEREIT] = tausch;
+		a->neu = 0;
+		speed = a->speed;
+		SDL_UnlockMutex(a->mutex);
+
+		bild = a->bild[GOL_BILD_ZEICHNEN];
+		if (SDL_MUSTLOCK(screen)) SDL_LockSurface(screen);
+		for (y = 0; y < a->n; y++) {
+			zeile = (Uint32 *) ((Uint8 *) screen->pixels + (size_t) y * a->pixel * screen->pitch);
+			for (x = 0; x < a->n; x++) {
+				farbe = a->farbe[bild[y * a->n + x]];
+				for (c = 0; c < a->pixel; c++)
+					*zeile++ = farbe;
+			}
+			for (r = 1; r < a->pixel; r++)
+				memcpy((Uint8 *) screen->pixels + ((size_t) y * a->pixel + r) * screen->pitch,
+						(Uint8 *) screen->pixels + (size_t) y * a->pixel * screen->pitch, breite * sizeof(Uint32));
+		}
+		if (SDL_MUSTLOCK(screen)) SDL_UnlockSurface(screen);
+
+		// Spielfeld zum Bildschirm "schicken"
+		SDL_Flip(screen);
+		if (speed > 0) usleep(speed);
+	}
+	return 0;
 }
 
 void GOL_gfx_gameover(void){
 	SDL_Event event;
 	int gameover=0;
+	int i; // für Schleife
+
+	// Renderthread beenden, er zeichnet vorher noch das letzte Bild
+	SDL_LockMutex(anzeige.mutex);
+	anzeige.ende = 1;
+	SDL_CondSignal(anzeige.cond);
+	SDL_UnlockMutex(anzeige.mutex);
+	SDL_WaitThread(anzeige.thread, NULL);
+	SDL_DestroyCond(anzeige.cond);
+	SDL_DestroyMutex(anzeige.mutex);
+	for (i = 0; i < 3; i++)
+		free(anzeige.bild[i]);
+	free(anzeige.summe);
 
 	while (gameover == 0) {
 			// Spiel gestartet